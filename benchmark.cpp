@@ -0,0 +1,549 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "fuel.hpp"
+#include "intcode.hpp"
+#include "wire_line.hpp"
+#include "password.hpp"
+#include "orbit.hpp"
+#include <iomanip>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+/////////////////////////////////////////////////
+// Benchmarks
+/////////////////////////////////////////////////
+namespace benchmark
+{
+/////////////////////////////////////////////////
+/// \brief Hardware counters of the calling
+/// thread, read through perf_event_open when the
+/// kernel allows it
+///
+/////////////////////////////////////////////////
+class Counters
+{
+public:
+    /////////////////////////////////////////////////
+    static constexpr std::array<const char*, 4> names = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+    /////////////////////////////////////////////////
+    Counters()
+    {
+        m_descriptors.fill(-1);
+
+#if defined(__linux__)
+        constexpr std::array<uint64_t, 4> events = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+        for(size_t counter = 0; counter < events.size(); ++counter)
+        {
+            perf_event_attr attributes = {};
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(attributes);
+            attributes.config = events[counter];
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.inherit = 1;
+
+            m_descriptors[counter] = ::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////
+    ~Counters()
+    {
+#if defined(__linux__)
+        for(auto descriptor: m_descriptors)
+        {
+            if(descriptor >= 0)
+            {
+                ::close(descriptor);
+            }
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////
+    Counters(const Counters&) = delete;
+    Counters& operator=(const Counters&) = delete;
+
+    /////////////////////////////////////////////////
+    bool available() const
+    {
+        return std::any_of(m_descriptors.begin(), m_descriptors.end(), [](int descriptor)
+        {
+            return descriptor >= 0;
+        });
+    }
+
+    /////////////////////////////////////////////////
+    void start()
+    {
+#if defined(__linux__)
+        for(auto descriptor: m_descriptors)
+        {
+            if(descriptor >= 0)
+            {
+                ::ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////
+    std::array<int64_t, 4> stop()
+    {
+        std::array<int64_t, 4> values;
+        values.fill(-1);
+
+#if defined(__linux__)
+        for(size_t counter = 0; counter < m_descriptors.size(); ++counter)
+        {
+            if(m_descriptors[counter] >= 0)
+            {
+                ::ioctl(m_descriptors[counter], PERF_EVENT_IOC_DISABLE, 0);
+
+                uint64_t value = 0;
+                if(::read(m_descriptors[counter], &value, sizeof(value)) == sizeof(value))
+                {
+                    values[counter] = int64_t(value);
+                }
+            }
+        }
+#endif
+
+        return values;
+    }
+
+private:
+    /////////////////////////////////////////////////
+    std::array<int, 4> m_descriptors;
+};
+
+/////////////////////////////////////////////////
+/// \brief Struct representing the measure of a
+/// single function over several samples
+///
+/////////////////////////////////////////////////
+struct Result
+{
+    /////////////////////////////////////////////////
+    std::string name;
+    int64_t iterations = 0;
+    double bytes = 0;
+    std::vector<double> samples;
+    std::array<int64_t, 4> counters = {-1, -1, -1, -1};
+
+    /////////////////////////////////////////////////
+    /// \brief Median time per iteration of the
+    /// samples, which are kept sorted
+    ///
+    /////////////////////////////////////////////////
+    double nanoseconds_per_iteration() const
+    {
+        return samples[samples.size() / 2];
+    }
+
+    /////////////////////////////////////////////////
+    double minimal_nanoseconds() const
+    {
+        return samples.front();
+    }
+
+    /////////////////////////////////////////////////
+    /// \brief Median absolute deviation of the
+    /// samples relative to their median
+    ///
+    /////////////////////////////////////////////////
+    double spread() const
+    {
+        std::vector<double> deviations;
+
+        for(auto sample: samples)
+        {
+            deviations.push_back(std::abs(sample - nanoseconds_per_iteration()));
+        }
+
+        std::nth_element(deviations.begin(), deviations.begin() + deviations.size() / 2, deviations.end());
+
+        return deviations[deviations.size() / 2] / nanoseconds_per_iteration();
+    }
+
+    /////////////////////////////////////////////////
+    double throughput() const
+    {
+        return bytes * 1e9 / nanoseconds_per_iteration();
+    }
+};
+
+/////////////////////////////////////////////////
+/// \brief Takes several samples of a function,
+/// each repeating it until the sample duration is
+/// reached
+///
+/////////////////////////////////////////////////
+Result measure(const std::string& name, double bytes, const std::function<int64_t()>& function, size_t sample_count = 7, double sample_seconds = 0.05)
+{
+    using clock = std::chrono::steady_clock;
+
+    Result result;
+    result.name = name;
+    result.bytes = bytes;
+
+    Counters counters;
+
+    volatile int64_t sink = function();
+
+    counters.start();
+
+    for(size_t sample = 0; sample < sample_count; ++sample)
+    {
+        int64_t iterations = 0;
+        double seconds = 0;
+
+        auto start = clock::now();
+
+        do
+        {
+            sink = sink + function();
+            ++iterations;
+            seconds = std::chrono::duration<double>(clock::now() - start).count();
+        } while(seconds < sample_seconds);
+
+        result.iterations += iterations;
+        result.samples.push_back(seconds * 1e9 / iterations);
+    }
+
+    result.counters = counters.stop();
+
+    for(auto& counter: result.counters)
+    {
+        if(counter >= 0)
+        {
+            counter /= result.iterations;
+        }
+    }
+
+    std::sort(result.samples.begin(), result.samples.end());
+
+    return result;
+}
+
+/////////////////////////////////////////////////
+void write_json(std::ostream& writer, const std::vector<Result>& results)
+{
+    writer << "{\n    \"results\": [\n";
+
+    for(size_t result = 0; result < results.size(); ++result)
+    {
+        const auto& measure = results[result];
+
+        writer << "        {\"name\": \"" << measure.name << "\", \"iterations\": " << measure.iterations << ", \"samples\": " << measure.samples.size() << ", \"ns_per_iteration\": " << std::fixed << std::setprecision(1) << measure.nanoseconds_per_iteration() << ", \"ns_minimum\": " << measure.minimal_nanoseconds() << ", \"spread\": " << std::setprecision(4) << measure.spread() << ", \"bytes_per_second\": " << std::setprecision(0) << measure.throughput();
+
+        for(size_t counter = 0; counter < measure.counters.size(); ++counter)
+        {
+            if(measure.counters[counter] >= 0)
+            {
+                writer << ", \"" << Counters::names[counter] << "\": " << measure.counters[counter];
+            }
+        }
+
+        writer << "}" << (result + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    writer << "    ]\n}\n";
+}
+
+/////////////////////////////////////////////////
+/// \brief Struct representing the timing of a
+/// function in a previous report
+///
+/////////////////////////////////////////////////
+struct Baseline
+{
+    /////////////////////////////////////////////////
+    double nanoseconds_per_iteration = 0;
+    double spread = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Reads back the timing of every
+/// function from a previous JSON report
+///
+/// Reports written before samples were taken
+/// give no spread, which is then read as zero.
+/// Lines whose numbers are malformed are skipped
+/// with a warning rather than failing the run.
+///
+/////////////////////////////////////////////////
+std::map<std::string, Baseline> read_json(const std::filesystem::path& path)
+{
+    std::map<std::string, Baseline> timings;
+
+    MappedFile file(path);
+
+    auto number = [](std::string_view line, std::string_view key, double& value)
+    {
+        size_t position = line.find(key);
+
+        if(position == std::string_view::npos)
+        {
+            return false;
+        }
+
+        position += key.size();
+
+        auto text = line.substr(position, line.find_first_of(",}", position) - position);
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+        return error == std::errc() && end == text.data() + text.size() && std::isfinite(value);
+    };
+
+    size_t skipped_count = 0;
+
+    for(auto line: Tokens(file.content(), Tokens::lines))
+    {
+        constexpr std::string_view name_key = "\"name\": \"";
+
+        size_t name = line.find(name_key);
+        Baseline timing;
+
+        if(name == std::string_view::npos)
+        {
+            continue;
+        }
+
+        bool has_spread = line.find("\"spread\": ") != std::string_view::npos;
+
+        if(!number(line, "\"ns_per_iteration\": ", timing.nanoseconds_per_iteration) || (has_spread && !number(line, "\"spread\": ", timing.spread)))
+        {
+            ++skipped_count;
+            continue;
+        }
+
+        name += name_key.size();
+        timings[std::string(line.substr(name, line.find('"', name) - name))] = timing;
+    }
+
+    if(skipped_count > 0)
+    {
+        std::cerr << "Skipped " << skipped_count << " malformed result(s) in " << path << std::endl;
+    }
+
+    return timings;
+}
+
+/////////////////////////////////////////////////
+/// \brief Measures every public function on the
+/// puzzle inputs, writes the report and compares
+/// it with a baseline report when given
+///
+/// Median times are compared, which a single
+/// lucky or unlucky sample cannot move. A function
+/// regresses when it is slower by more than the
+/// tolerance and three times the spread of both
+/// reports.
+///
+/// \return Number of regressions found
+///
+/////////////////////////////////////////////////
+int run(const std::filesystem::path& report_path, const std::filesystem::path& baseline_path, double tolerance = 0.1)
+{
+    auto masses = get_input_list<int64_t>("inputs/01-mass_input.txt");
+    auto gravity_program = get_input_list<int64_t>("inputs/02-program_integers.txt");
+    auto diagnostic_program = get_input_list<int64_t>("inputs/05-program_integers.txt");
+    auto wires = wire_line::input_list("inputs/03-wire-maps.txt");
+    auto orbits = get_input_list<std::string>("inputs/06-orbit-map.txt");
+    auto orbit_parents = orbit::parents(orbits);
+    auto wire_points = wire_line::definer(wires[0]);
+
+    std::string mass_text;
+    for(auto mass: masses)
+    {
+        mass_text += std::to_string(mass) + '\n';
+    }
+
+    auto file_size = [](const std::filesystem::path& path)
+    {
+        return std::filesystem::exists(path) ? double(std::filesystem::file_size(path)) : 0.0;
+    };
+
+    std::vector<Result> results;
+
+    results.push_back(measure("get_input_list<int64_t>", file_size("inputs/05-program_integers.txt"), []()
+    {
+        return int64_t(get_input_list<int64_t>("inputs/05-program_integers.txt").size());
+    }));
+
+    results.push_back(measure("get_input_list<std::string>", file_size("inputs/06-orbit-map.txt"), []()
+    {
+        return int64_t(get_input_list<std::string>("inputs/06-orbit-map.txt").size());
+    }));
+
+    results.push_back(measure("parse_integers", mass_text.size(), [&mass_text]()
+    {
+        std::vector<int64_t> parsed;
+        parse_integers(mass_text, parsed);
+        return int64_t(parsed.size());
+    }));
+
+    results.push_back(measure("fuel::requirement", masses.size() * sizeof(int64_t), [&masses]()
+    {
+        return fuel::requirement(masses);
+    }));
+
+    results.push_back(measure("fuel::total_requirement", masses.size() * sizeof(int64_t), [&masses]()
+    {
+        return fuel::total_requirement(masses);
+    }));
+
+    results.push_back(measure("fuel::stream_requirement", mass_text.size(), [&mass_text]()
+    {
+        std::istringstream reader(mass_text);
+        return fuel::stream_requirement(reader, 1).y;
+    }));
+
+    results.push_back(measure("intcode::program_caller", gravity_program.size() * sizeof(int64_t), [&gravity_program]()
+    {
+        return intcode::program_caller(gravity_program, {12, 2}).x;
+    }));
+
+    results.push_back(measure("intcode::instruction_solver", gravity_program.size() * sizeof(int64_t), [&gravity_program]()
+    {
+        return intcode::instruction_solver(gravity_program, 19690720);
+    }));
+
+    results.push_back(measure("intcode::program_caller/diagnostic", diagnostic_program.size() * sizeof(int64_t), [&diagnostic_program]()
+    {
+        return intcode::program_caller(diagnostic_program, {5, 0}).y;
+    }));
+
+    results.push_back(measure("wire_line::definer", file_size("inputs/03-wire-maps.txt") / 2, [&wires]()
+    {
+        return int64_t(wire_line::definer(wires[0]).size());
+    }));
+
+    results.push_back(measure("Vector2Map::insert_steps", wire_points.size() * sizeof(Vector2<int64_t>), [&wire_points]()
+    {
+        Vector2Map<int64_t> steps(wire_points.size(), hardware_threads());
+        steps.insert_steps(wire_points.data(), wire_points.size());
+        return int64_t(steps.size());
+    }));
+
+    {
+        Vector2Map<int64_t> steps(wire_points.size(), hardware_threads());
+        steps.insert_steps(wire_points.data(), wire_points.size());
+
+        results.push_back(measure("Vector2Map::find", wire_points.size() * sizeof(Vector2<int64_t>), [&wire_points, &steps]()
+        {
+            int64_t found = 0;
+            for(const auto& point: wire_points)
+            {
+                found += steps.find(point).value_or(0);
+            }
+
+            return found;
+        }));
+    }
+
+    results.push_back(measure("wire_line::closest_intersection", file_size("inputs/03-wire-maps.txt"), [&wires]()
+    {
+        return wire_line::closest_intersection(wires).standard();
+    }));
+
+    results.push_back(measure("wire_line::fewest_combined_steps", file_size("inputs/03-wire-maps.txt"), [&wires]()
+    {
+        return wire_line::fewest_combined_steps(wires).standard();
+    }));
+
+    results.push_back(measure("password::criteria_count", 0, []()
+    {
+        return password::criteria_count({372304, 847060});
+    }));
+
+    results.push_back(measure("password::group_criteria_count", 0, []()
+    {
+        return password::group_criteria_count({372304, 847060});
+    }));
+
+    results.push_back(measure("orbit::total_count", file_size("inputs/06-orbit-map.txt"), [&orbits]()
+    {
+        return orbit::total_count(orbits);
+    }));
+
+    results.push_back(measure("orbit::transfer_count", file_size("inputs/06-orbit-map.txt"), [&orbits]()
+    {
+        return orbit::transfer_count(orbits);
+    }));
+
+    results.push_back(measure("orbit::parents", file_size("inputs/06-orbit-map.txt"), [&orbits]()
+    {
+        return int64_t(orbit::parents(orbits).size());
+    }));
+
+    results.push_back(measure("orbit::transfer_count/parents", 0, [&orbit_parents]()
+    {
+        return orbit::transfer_count(orbit_parents, "YOU", "SAN");
+    }));
+
+    std::map<std::string, Baseline> baseline;
+    if(!baseline_path.empty())
+    {
+        baseline = read_json(baseline_path);
+    }
+
+    int regressions = 0;
+
+    for(const auto& result: results)
+    {
+        std::cout << std::left << std::setw(40) << result.name << std::right << std::fixed << std::setprecision(1) << std::setw(16) << result.nanoseconds_per_iteration() << " ns";
+
+        if(result.bytes > 0)
+        {
+            std::cout << std::setw(12) << std::setprecision(1) << result.throughput() / (1 << 20) << " MiB/s";
+        }
+
+        std::cout << " +-" << std::setw(5) << std::setprecision(1) << result.spread() * 100 << '%';
+
+        if(auto previous = baseline.find(result.name); previous != baseline.end() && previous->second.nanoseconds_per_iteration > 0)
+        {
+            double ratio = result.nanoseconds_per_iteration() / previous->second.nanoseconds_per_iteration;
+            double threshold = std::max(tolerance, 3 * (result.spread() + previous->second.spread));
+
+            std::cout << std::setw(10) << std::setprecision(2) << ratio << 'x';
+
+            if(ratio > 1 + threshold)
+            {
+                std::cout << " REGRESSION";
+                ++regressions;
+            }
+        }
+
+        std::cout << std::endl;
+    }
+
+    std::ofstream writer(report_path);
+    if(writer)
+    {
+        write_json(writer, results);
+    }
+
+    return regressions;
+}
+
+} // namespace benchmark
+
+/////////////////////////////////////////////////
+// Main stream
+/////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    return benchmark::run(argc > 1 ? argv[1] : "benchmark.json", argc > 2 ? argv[2] : "") > 0 ? 1 : 0;
+}
@@ -1,848 +1,357 @@
 /////////////////////////////////////////////////
 // Headers
 /////////////////////////////////////////////////
-#include <iostream>
-#include <cstdint>
-#include <fstream>
-#include <filesystem>
-#include <cmath>
-#include <variant>
-#include <map>
+#include "fuel.hpp"
+#include "intcode.hpp"
+#include "wire_line.hpp"
+#include "password.hpp"
+#include "orbit.hpp"
+#include "verification.hpp"
+#include "server.hpp"
+#include <iomanip>
 
-/////////////////////////////////////////////////
-// Helpers
-/////////////////////////////////////////////////
-template <typename Type>
-std::vector<Type> get_input_list(std::filesystem::path path)
-{
-    std::vector<Type> input_list;
-
-    if(!std::filesystem::exists(path))
-    {
-        return input_list;
-    }
-
-    std::ifstream reader(path);
-
-    if(reader)
-    {
-        std::string input_token;
-        while(reader >> input_token)
-        {
-            if constexpr(std::is_same<Type, int64_t>::value || std::is_same<Type, int32_t>::value || std::is_same<Type, int16_t>::value || std::is_same<Type, int>::value)
-            {
-                input_list.push_back(std::stoi(input_token));
-            }
-            else
-            {
-                input_list.push_back(input_token);
-            }
-        }
-
-        reader.close();
-    }
-
-    return input_list;
-}
+// Builds that do not hash the solver sources cannot tell stale answers apart, so they never cache
+#ifndef SOLVER_VERSION
+#define SOLVER_VERSION ""
+#endif
 
 /////////////////////////////////////////////////
-/// \brief Struct representing instructions for
-/// an Intcode program
-///
+// Answers
 /////////////////////////////////////////////////
-struct Sentence
-{
-    /////////////////////////////////////////////////
-    int64_t noun = 0;
-    int64_t verb = 0;
-};
+/////////////////////////////////////////////////
+using Answer = std::variant<std::string, int64_t>;
 
 /////////////////////////////////////////////////
-/// \brief Struct representing a vector or a point
-/// by its coordinates in a 2D dimension
+/// \brief Answers stored on disk, one file per
+/// key, so that a part is only solved again once
+/// its inputs or parameters change
+///
+/// Entries are written to a temporary file then
+/// renamed over their final name, which keeps
+/// concurrent writers from exposing partial files.
 ///
 /////////////////////////////////////////////////
-template <typename Type>
-struct Vector2
+class AnswerCache
 {
+public:
     /////////////////////////////////////////////////
-    Type x;
-    Type y;
-
-    /////////////////////////////////////////////////
-    Type standard()
+    explicit AnswerCache(std::filesystem::path directory) :
+    m_directory(std::move(directory))
     {
-        return std::abs(x) + std::abs(y);
     }
 
     /////////////////////////////////////////////////
-    bool operator==(const Vector2& another_vector)
-    {
-        return (x == another_vector.x && y == another_vector.y);
-    }
-};
-
-/////////////////////////////////////////////////
-/// \brief Struct representing a vector or a point
-/// by its coordinates in a 3D dimension
-///
-/////////////////////////////////////////////////
-template <typename Type>
-struct Vector3
-{
+    /// \brief Key of a function applied to input
+    /// files with the given parameters, salted with
+    /// the version of the solvers so that a changed
+    /// solver never reads answers of a previous one
+    ///
     /////////////////////////////////////////////////
-    Type x;
-    Type y;
-    Type z;
-};
-
-/////////////////////////////////////////////////
-// Challenges
-/////////////////////////////////////////////////
-namespace fuel
-{
-/////////////////////////////////////////////////
-int64_t calculator(int64_t mass)
-{
-    return std::floor(mass / 3) - 2;
-}
-
-/////////////////////////////////////////////////
-int64_t requirement(std::vector<int64_t> inputs)
-{
-    if(inputs.empty())
-    {
-        return 0;
-    }
-
-    int64_t fuel = 0;
-
-    for(const auto& mass: inputs)
+    static uint64_t key(std::string_view function, std::string_view parameters, const std::vector<uint64_t>& input_hashes = {})
     {
-        fuel += calculator(mass);
-    }
+        uint64_t hash = content_hash(parameters, content_hash(function, content_hash(SOLVER_VERSION)));
 
-    return fuel;
-}
+        for(auto input_hash: input_hashes)
+        {
+            hash = content_hash({reinterpret_cast<const char*>(&input_hash), sizeof(input_hash)}, hash);
+        }
 
-/////////////////////////////////////////////////
-int64_t total_requirement(std::vector<int64_t> inputs)
-{
-    if(inputs.empty())
-    {
-        return 0;
+        return hash;
     }
 
-    int64_t fuel = 0;
-
-    for(const auto& mass: inputs)
+    /////////////////////////////////////////////////
+    /// \brief Formats the arguments given to a
+    /// function into the parameters of its key
+    ///
+    /////////////////////////////////////////////////
+    template <typename... Arguments>
+    static std::string parameters(const Arguments&... arguments)
     {
-        auto remaining_mass = mass;
+        std::stringstream stream;
+        ((stream << arguments << ';'), ...);
 
-        while(remaining_mass > 0)
-        {
-            remaining_mass = calculator(remaining_mass);
-
-            if(remaining_mass > 0)
-            {
-                fuel += remaining_mass;
-            }
-        }
+        return stream.str();
     }
 
-    return fuel;
-}
-
-} // namespace fuel
-
-/////////////////////////////////////////////////
-namespace intcode
-{
-/////////////////////////////////////////////////
-std::vector<int64_t> program_translater(std::vector<int64_t> inputs, Sentence instructions = {})
-{
-    int64_t read_position = 0;
-    int64_t diagnostic_code = 0;
-
-    bool done = false;
-    while(!done)
+    /////////////////////////////////////////////////
+    std::optional<Answer> find(uint64_t key) const
     {
-        std::string instruction = std::to_string(inputs[read_position]);
+        std::ifstream reader(entry(key));
 
-        int64_t opcode = 0;
-
-        struct Modes
-        {
-            int64_t first = 0;
-            int64_t second = 0;
-            int64_t third = 0;
-        } modes;
-
-        if(instruction.size() <= 2)
-        {
-            opcode = std::stoi(instruction);
-        }
-        else
+        char type = 0;
+        if(!(reader >> type) || reader.get() != ' ')
         {
-            opcode = std::stoi(instruction.substr(instruction.size() - 2, 2));
-
-            if(instruction.size() >= 3)
-            {
-                modes.first = instruction[instruction.size() - 3] - '0';
-            }
-
-            if(instruction.size() >= 4)
-            {
-                modes.second = instruction[instruction.size() - 4] - '0';
-            }
-
-            if(instruction.size() >= 5)
-            {
-                modes.third = instruction[instruction.size() - 5] - '0';
-            }
+            return std::nullopt;
         }
 
-        int64_t incrementer = 0;
+        std::string value;
+        std::getline(reader, value);
 
-        switch(opcode)
+        if(type == 's')
         {
-        case 1:
-        {
-            Vector2<int64_t> values;
-
-            if(modes.first == 0)
-            {
-                values.x = inputs[inputs[read_position + 1]];
-            }
-            else
-            {
-                values.x = inputs[read_position + 1];
-            }
-
-            if(modes.second == 0)
-            {
-                values.y = inputs[inputs[read_position + 2]];
-            }
-            else
-            {
-                values.y = inputs[read_position + 2];
-            }
-
-            inputs[inputs[read_position + 3]] = values.x + values.y;
-            incrementer = 4;
-            break;
+            return value;
         }
 
-        case 2:
-        {
-            Vector2<int64_t> values;
-
-            if(modes.first == 0)
-            {
-                values.x = inputs[inputs[read_position + 1]];
-            }
-            else
-            {
-                values.x = inputs[read_position + 1];
-            }
-
-            if(modes.second == 0)
-            {
-                values.y = inputs[inputs[read_position + 2]];
-            }
-            else
-            {
-                values.y = inputs[read_position + 2];
-            }
-
-            inputs[inputs[read_position + 3]] = values.x * values.y;
-            incrementer = 4;
-            break;
-        }
+        int64_t integer = 0;
+        auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), integer);
 
-        case 3:
+        if(type != 'i' || error != std::errc() || end != value.data() + value.size())
         {
-            inputs[inputs[read_position + 1]] = instructions.noun;
-
-            incrementer = 2;
-
-            break;
+            return std::nullopt;
         }
 
-        case 4:
-        {
-            int64_t read_address = 0;
-
-            if(modes.first == 0)
-            {
-                read_address = inputs[read_position + 1];
-            }
-            else
-            {
-                read_address = read_position + 1;
-            }
-
-            diagnostic_code = inputs[read_address];
-
-            incrementer = 2;
-            break;
-        }
+        return integer;
+    }
 
-        case 5:
+    /////////////////////////////////////////////////
+    void store(uint64_t key, const Answer& answer) const
+    {
+        std::error_code error;
+        if(!std::filesystem::create_directories(m_directory, error) && error)
         {
-            Vector2<int64_t> values;
-
-            if(modes.first == 0)
-            {
-                values.x = inputs[inputs[read_position + 1]];
-            }
-            else
-            {
-                values.x = inputs[read_position + 1];
-            }
-
-            if(values.x != 0)
-            {
-                if(modes.second == 0)
-                {
-                    values.y = inputs[inputs[read_position + 2]];
-                }
-                else
-                {
-                    values.y = inputs[read_position + 2];
-                }
-
-                read_position = values.y;
-            }
-            else
-            {
-                incrementer = 3;
-            }
-
-            break;
+            return;
         }
 
-        case 6:
-        {
+        std::stringstream temporary_name;
+        temporary_name << entry(key).filename().string() << '.' << std::this_thread::get_id() << '.' << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
 
-            Vector2<int64_t> values;
+        auto temporary_path = m_directory / temporary_name.str();
 
-            if(modes.first == 0)
-            {
-                values.x = inputs[inputs[read_position + 1]];
-            }
-            else
-            {
-                values.x = inputs[read_position + 1];
-            }
-
-            if(values.x == 0)
-            {
-                if(modes.second == 0)
-                {
-                    values.y = inputs[inputs[read_position + 2]];
-                }
-                else
-                {
-                    values.y = inputs[read_position + 2];
-                }
-
-                read_position = values.y;
-            }
-            else
-            {
-                incrementer = 3;
-            }
-
-            break;
-        }
-
-        case 7:
         {
-            Vector2<int64_t> values;
+            std::ofstream writer(temporary_path);
 
-            if(modes.first == 0)
+            std::visit([&writer](auto&& value)
             {
-                values.x = inputs[inputs[read_position + 1]];
-            }
-            else
-            {
-                values.x = inputs[read_position + 1];
-            }
-
-            if(modes.second == 0)
-            {
-                values.y = inputs[inputs[read_position + 2]];
-            }
-            else
-            {
-                values.y = inputs[read_position + 2];
-            }
+                writer << (std::is_same<std::decay_t<decltype(value)>, std::string>::value ? 's' : 'i') << ' ' << value << '\n';
+            }, answer);
 
-            if(values.x < values.y)
+            if(!writer)
             {
-                inputs[inputs[read_position + 3]] = 1;
+                return;
             }
-            else
-            {
-                inputs[inputs[read_position + 3]] = 0;
-            }
-
-            incrementer = 4;
-            break;
         }
 
-        case 8:
-        {
-            Vector2<int64_t> values;
+        std::filesystem::rename(temporary_path, entry(key), error);
 
-            if(modes.first == 0)
-            {
-                values.x = inputs[inputs[read_position + 1]];
-            }
-            else
-            {
-                values.x = inputs[read_position + 1];
-            }
-
-            if(modes.second == 0)
-            {
-                values.y = inputs[inputs[read_position + 2]];
-            }
-            else
-            {
-                values.y = inputs[read_position + 2];
-            }
-
-            if(values.x == values.y)
-            {
-                inputs[inputs[read_position + 3]] = 1;
-            }
-            else
-            {
-                inputs[inputs[read_position + 3]] = 0;
-            }
-
-            incrementer = 4;
-            break;
-        }
-
-        default:
-            done = true;
-            break;
+        if(error)
+        {
+            std::filesystem::remove(temporary_path, error);
         }
-
-        read_position += incrementer;
     }
 
-    inputs.push_back(diagnostic_code);
-
-    return std::move(inputs);
-}
-
-/////////////////////////////////////////////////
-Vector2<int64_t> program_caller(std::vector<int64_t> inputs, Sentence instructions)
-{
-    //Initialization
-    if(inputs[0] != 3)
+private:
+    /////////////////////////////////////////////////
+    std::filesystem::path entry(uint64_t key) const
     {
-        inputs[1] = instructions.noun;
-        inputs[2] = instructions.verb;
-    }
-
-    inputs = program_translater(inputs, instructions);
+        std::stringstream name;
+        name << std::hex << std::setw(16) << std::setfill('0') << key;
 
-    return {inputs.front(), inputs.back()};
-}
-
-/////////////////////////////////////////////////
-int64_t instruction_solver(std::vector<int64_t> inputs, int64_t code)
-{
-    Sentence instructions;
-
-    for(instructions.noun = 0; instructions.noun <= 99; ++instructions.noun)
-    {
-        for(instructions.verb = 0; instructions.verb <= 99; ++instructions.verb)
-        {
-            if(program_caller(inputs, instructions).x == code)
-            {
-                return 100 * instructions.noun + instructions.verb;
-            }
-        }
+        return m_directory / name.str();
     }
 
-    return 0;
-}
-
-} // namespace intcode
+    /////////////////////////////////////////////////
+    std::filesystem::path m_directory;
+};
 
 /////////////////////////////////////////////////
-namespace wire_line
-{
+// Main stream
 /////////////////////////////////////////////////
-std::vector<Vector2<int64_t>> definer(std::vector<std::string> inputs)
+int main(int argc, char* argv[])
 {
-    std::vector<Vector2<int64_t>> points;
-
-    Vector2<int64_t> reading_position = {0, 0};
-
-    for(auto next: inputs)
+    if(argc > 1 && std::string_view(argv[1]) == "--serve")
     {
-        char direction = next[0];
-        int64_t max_step = std::stoi(next.erase(0, 1));
-
-        for(int64_t step = 0; step < max_step; ++step)
-        {
-            switch(direction)
-            {
-            case 'L':
-                reading_position.x -= 1;
-                break;
-            case 'U':
-                reading_position.y -= 1;
-                break;
-            case 'R':
-                reading_position.x += 1;
-                break;
-            case 'D':
-                reading_position.y += 1;
-                break;
-            default:
-                break;
-            }
-
-            points.push_back(reading_position);
-        }
+        return server::run(argc > 2 ? argv[2] : "advent-of-code.sock");
     }
 
-    return points;
-}
-
-/////////////////////////////////////////////////
-std::vector<Vector2<int64_t>> intersections(std::vector<Vector2<int64_t>>& first_wire, std::vector<Vector2<int64_t>>& second_wire)
-{
-    std::vector<Vector2<int64_t>> intersection_points;
-
-    for(auto first_wire_point: first_wire)
+    if(argc > 1 && std::string_view(argv[1]) == "--verify")
     {
-        for(auto second_wire_point: second_wire)
-        {
-            if(first_wire_point == second_wire_point)
-            {
-                intersection_points.push_back(first_wire_point);
-            }
-        }
+        return verification::run(argc > 2 ? std::stoull(argv[2]) : 1) > 0 ? 1 : 0;
     }
 
-    return intersection_points;
-}
-
-/////////////////////////////////////////////////
-Vector2<int64_t> closest_intersection(std::array<std::vector<std::string>, 2> wires)
-{
-    Vector2<int64_t> closest_wire = {0, 0};
-
-    auto&& first_wire = definer(wires[0]);
-    auto&& second_wire = definer(wires[1]);
-
-    auto&& intersection_points = intersections(first_wire, second_wire);
-
-    for(auto intersection: intersection_points)
+    struct Solution
     {
-        if((closest_wire.x == 0 && closest_wire.y == 0) || (std::abs(intersection.x) + std::abs(intersection.y) < closest_wire.standard()))
-        {
-            closest_wire = {std::abs(intersection.x), std::abs(intersection.y)};
-        }
-    }
-
-    return closest_wire;
-}
+        Answer answer;
+        double latency = 0;
+        size_t allocation_count = 0;
+        size_t allocated_bytes = 0;
+        size_t peak_bytes = 0;
+    };
 
-/////////////////////////////////////////////////
-Vector2<int64_t> fewest_combined_steps(std::array<std::vector<std::string>, 2> wires)
-{
-    auto&& first_wire = definer(wires[0]);
-    auto&& second_wire = definer(wires[1]);
+    AnswerCache cache(".cache/answers");
+    bool cache_enabled = !(argc > 1 && std::string_view(argv[1]) == "--no-cache") && !std::string_view(SOLVER_VERSION).empty();
 
-    auto&& intersection_points = intersections(first_wire, second_wire);
+    ThreadPool pool;
 
-    Vector2<int64_t> fewest = {int64_t(first_wire.size()), int64_t(second_wire.size())};
-
-    for(auto intersection: intersection_points)
+    /////////////////////////////////////////////////
+    auto load = [](auto loader)
     {
-        Vector2<int64_t> step = {std::distance(first_wire.begin(), std::find(first_wire.begin(), first_wire.end(), intersection)) + 1, std::distance(second_wire.begin(), std::find(second_wire.begin(), second_wire.end(), intersection)) + 1};
-
-        if(step.standard() < fewest.standard())
-        {
-            fewest = step;
-        }
-    }
-
-    return fewest;
-}
-
-/////////////////////////////////////////////////
-std::array<std::vector<std::string>, 2> input_list(std::filesystem::path path)
-{
-    std::vector<std::string> wires = get_input_list<std::string>(path);
+        return std::async(std::launch::deferred, loader).share();
+    };
 
-    std::array<std::vector<std::string>, 2> wire_points;
-
-    for(size_t wire = 0; wire < wires.size(); wire++)
+    /////////////////////////////////////////////////
+    struct Input
     {
-        std::stringstream wire_map(wires[wire]);
-
-        std::string token;
-        while(std::getline(wire_map, token, ','))
-        {
-            wire_points[wire].push_back(token);
-        }
-    }
+        std::shared_ptr<const MappedFile> file;
+        uint64_t hash = 0;
+    };
 
-    return wire_points;
-}
+    auto map_input = [](const std::filesystem::path& path)
+    {
+        auto file = std::make_shared<const MappedFile>(path);
+        return Input{file, content_hash(file->content())};
+    };
 
-} // namespace wire_line
+    Input masses_input = map_input("inputs/01-mass_input.txt");
+    Input gravity_program_input = map_input("inputs/02-program_integers.txt");
+    Input wires_input = map_input("inputs/03-wire-maps.txt");
+    Input diagnostic_program_input = map_input("inputs/05-program_integers.txt");
+    Input orbits_input = map_input("inputs/06-orbit-map.txt");
 
-/////////////////////////////////////////////////
-namespace password
-{
-/////////////////////////////////////////////////
-int64_t criteria_count(Vector2<int64_t> range)
-{
-    int64_t minimal_number = range.x;
-    int64_t current_number = minimal_number;
+    auto masses = load([file = masses_input.file]()
+    {
+        return get_input_list<int64_t>(*file);
+    });
 
-    int64_t count = 0;
+    auto gravity_program = load([file = gravity_program_input.file]()
+    {
+        return get_input_list<int64_t>(*file);
+    });
 
-    while(current_number < range.y)
+    auto wires = load([file = wires_input.file]()
     {
-        bool same_digits = false;
+        return wire_line::input_list(*file);
+    });
 
-        auto digits = std::to_string(current_number);
-        for(size_t character = 0; character < digits.size() - 1; ++character)
-        {
-            if(digits[character] - '0' > digits[character + 1] - '0')
-            {
-                digits[character + 1] = digits[character];
-            }
+    auto diagnostic_program = load([file = diagnostic_program_input.file]()
+    {
+        return get_input_list<int64_t>(*file);
+    });
 
-            if(digits[character] == digits[character + 1])
-            {
-                same_digits = true;
-            }
-        }
+    auto orbits = load([file = orbits_input.file]()
+    {
+        return get_input_list<std::string>(*file);
+    });
 
-        current_number = std::stoi(digits);
+    /////////////////////////////////////////////////
+    auto solve = [&pool, &cache, cache_enabled](std::string_view function, const std::vector<uint64_t>& input_hashes, auto solver, auto... arguments)
+    {
+        uint64_t key = AnswerCache::key(function, AnswerCache::parameters(arguments...), input_hashes);
 
-        if(current_number <= range.y && same_digits)
+        return pool.submit([&cache, cache_enabled, key, solver, arguments...]()
         {
-            count++;
-        }
-
-        current_number++;
-    }
-
-    return count;
-}
+            auto start = std::chrono::steady_clock::now();
 
-/////////////////////////////////////////////////
-int64_t group_criteria_count(Vector2<int64_t> range)
-{
-    int64_t minimal_number = range.x;
-    int64_t current_number = minimal_number;
-
-    int64_t count = 0;
-
-    while(current_number < range.y)
-    {
-        bool same_digits = false;
+            Solution solution;
+            std::optional<Answer> answer;
 
-        auto digits = std::to_string(current_number);
-        for(size_t character = 0; character < digits.size() - 1; ++character)
-        {
-            if(digits[character] - '0' > digits[character + 1] - '0')
+            if(cache_enabled)
             {
-                digits[character + 1] = digits[character];
+                answer = cache.find(key);
             }
-        }
 
-        for(size_t character = 0; character < digits.size() - 1; ++character)
-        {
-            if(digits[character] == digits[character + 1])
+            if(!answer)
             {
-                same_digits = true;
+                std::pmr::monotonic_buffer_resource arena(std::pmr::new_delete_resource());
+                TrackingResource tracking(&arena);
 
-                if(character > 0 && digits[character - 1] == digits[character])
-                {
-                    same_digits = false;
-                }
+                answer = solver(&tracking, arguments...);
 
-                if(character < digits.size() - 1 && digits[character + 2] == digits[character])
-                {
-                    same_digits = false;
-                }
+                solution.allocation_count = tracking.allocation_count();
+                solution.allocated_bytes = tracking.allocated_bytes();
+                solution.peak_bytes = tracking.peak_bytes();
 
-                if(same_digits)
+                if(cache_enabled)
                 {
-                    break;
+                    cache.store(key, *answer);
                 }
             }
-        }
-
-        current_number = std::stoi(digits);
-
-        if(current_number <= range.y && same_digits)
-        {
-            count++;
-        }
 
-        current_number++;
-    }
+            solution.answer = *answer;
+            solution.latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 
-    return count;
-}
+            return solution;
+        });
+    };
 
-} // namespace password
+    std::vector<std::future<Solution>> answers;
 
-/////////////////////////////////////////////////
-namespace orbit
-{
-/////////////////////////////////////////////////
-int64_t deep_relation_count(std::map<std::string, std::vector<std::string>>& orbital_relationships, std::string object)
-{
-    int64_t count = orbital_relationships[object].size();
-
-    for(auto orbit: orbital_relationships[object])
+    answers.push_back(solve("fuel::requirement", {masses_input.hash}, [masses](std::pmr::memory_resource* resource) -> Answer
     {
-        count += deep_relation_count(orbital_relationships, orbit);
-    }
-
-    return count;
-}
+        return fuel::requirement(masses.get(), resource);
+    }));
 
-/////////////////////////////////////////////////
-int64_t total_count(std::vector<std::string> inputs)
-{
-    std::map<std::string, std::vector<std::string>> orbital_relationships;
-
-    for(auto input: inputs)
+    answers.push_back(solve("fuel::total_requirement", {masses_input.hash}, [masses](std::pmr::memory_resource* resource) -> Answer
     {
-        std::string base_object = input.substr(0, 3);
-        std::string orbiter_object = input.substr(4, 7);
-
-        orbital_relationships[base_object].push_back(orbiter_object);
-    }
-
-    int64_t count = 0;
+        return fuel::total_requirement(masses.get(), resource);
+    }));
 
-    for(auto& [object, relationships]: orbital_relationships)
+    answers.push_back(solve("intcode::program_caller.x", {gravity_program_input.hash}, [gravity_program](std::pmr::memory_resource* resource, Sentence sentence) -> Answer
     {
-        count += deep_relation_count(orbital_relationships, object);
-    }
-
-    return count;
-}
-
-/////////////////////////////////////////////////
-std::string family_tree(std::map<std::string, std::vector<std::string>>& orbital_relationships, std::string orbit)
-{
-    std::string tree = orbit;
+        return intcode::program_caller(gravity_program.get(), sentence, resource).x;
+    }, Sentence{12, 2}));
 
-    for(auto& [object, relationships]: orbital_relationships)
+    answers.push_back(solve("intcode::instruction_solver", {gravity_program_input.hash}, [gravity_program](std::pmr::memory_resource* resource, int64_t output) -> Answer
     {
-        if(std::find(relationships.begin(), relationships.end(), orbit) != relationships.end())
-        {
-            tree += family_tree(orbital_relationships, object);
-        }
-    }
-
-    return tree;
-}
+        return intcode::instruction_solver(gravity_program.get(), output, resource);
+    }, int64_t(19690720)));
 
-/////////////////////////////////////////////////
-int64_t transfer_count(std::vector<std::string> inputs)
-{
-    std::map<std::string, std::vector<std::string>> orbital_relationships;
-
-    for(auto input: inputs)
+    answers.push_back(solve("wire_line::closest_intersection", {wires_input.hash}, [wires](std::pmr::memory_resource* resource) -> Answer
     {
-        std::string base_object = input.substr(0, 3);
-        std::string orbiter_object = input.substr(4, 7);
-
-        orbital_relationships[base_object].push_back(orbiter_object);
-    }
+        return wire_line::closest_intersection(wires.get(), resource).standard();
+    }));
 
-    std::string santa_tree = family_tree(orbital_relationships, "SAN");
-    santa_tree.erase(0, 3);
-
-    std::string you_tree = family_tree(orbital_relationships, "YOU");
-    you_tree.erase(0, 3);
-
-    std::string common_object;
-
-    for(size_t position = 0; position < santa_tree.size(); position += 3)
+    answers.push_back(solve("wire_line::fewest_combined_steps", {wires_input.hash}, [wires](std::pmr::memory_resource* resource) -> Answer
     {
-        std::string object({santa_tree[position], santa_tree[position + 1], santa_tree[position + 2]});
+        return wire_line::fewest_combined_steps(wires.get(), resource).standard();
+    }));
 
-        size_t common_object_position = 0;
+    answers.push_back(solve("password::criteria_count", {}, [](std::pmr::memory_resource*, Vector2<int64_t> range) -> Answer
+    {
+        return password::criteria_count(range);
+    }, Vector2<int64_t>{372304, 847060}));
 
-        common_object_position = you_tree.find(object, common_object_position);
-        if(common_object_position != std::string::npos)
-        {
-            common_object = object;
+    answers.push_back(solve("password::group_criteria_count", {}, [](std::pmr::memory_resource*, Vector2<int64_t> range) -> Answer
+    {
+        return password::group_criteria_count(range);
+    }, Vector2<int64_t>{372304, 847060}));
 
-            if(common_object_position % 3 == 0)
-            {
-                break;
-            }
-            else
-            {
-                continue;
-            }
-        }
-    }
+    answers.push_back(solve("intcode::program_caller.y", {diagnostic_program_input.hash}, [diagnostic_program](std::pmr::memory_resource* resource, Sentence sentence) -> Answer
+    {
+        return intcode::program_caller(diagnostic_program.get(), sentence, resource).y;
+    }, Sentence{1, 0}));
 
-    return (santa_tree.substr(0, santa_tree.find(common_object)).size() + you_tree.substr(0, you_tree.find(common_object)).size()) / 3;
-}
+    answers.push_back(solve("intcode::program_caller.y", {diagnostic_program_input.hash}, [diagnostic_program](std::pmr::memory_resource* resource, Sentence sentence) -> Answer
+    {
+        return intcode::program_caller(diagnostic_program.get(), sentence, resource).y;
+    }, Sentence{5, 0}));
 
-} // namespace orbit
+    answers.push_back(solve("orbit::total_count", {orbits_input.hash}, [orbits](std::pmr::memory_resource* resource) -> Answer
+    {
+        return orbit::total_count(orbits.get(), resource);
+    }));
 
-/////////////////////////////////////////////////
-// Main stream
-/////////////////////////////////////////////////
-int main()
-{
-    std::vector<std::variant<std::string, int64_t>> answers;
-
-    answers.push_back(fuel::requirement(get_input_list<int64_t>("inputs/01-mass_input.txt")));
-    answers.push_back(fuel::total_requirement(get_input_list<int64_t>("inputs/01-mass_input.txt")));
-    answers.push_back(intcode::program_caller(get_input_list<int64_t>("inputs/02-program_integers.txt"), {12, 2}).x);
-    answers.push_back(intcode::instruction_solver(get_input_list<int64_t>("inputs/02-program_integers.txt"), 19690720));
-    answers.push_back("too long"/*wire_line::closest_intersection(wire_line::input_list("inputs/03-wire-maps.txt")).standard()*/);
-    answers.push_back("too long"/*wire_line::fewest_combined_steps(wire_line::input_list("inputs/03-wire-maps.txt")).standard()*/);
-    answers.push_back(password::criteria_count({372304, 847060}));
-    answers.push_back(password::group_criteria_count({372304, 847060}));
-    answers.push_back(intcode::program_caller(get_input_list<int64_t>("inputs/05-program_integers.txt"), {1, 0}).y);
-    answers.push_back(intcode::program_caller(get_input_list<int64_t>("inputs/05-program_integers.txt"), {5, 0}).y);
-    answers.push_back(orbit::total_count(get_input_list<std::string>("inputs/06-orbit-map.txt")));
-    answers.push_back(orbit::transfer_count(get_input_list<std::string>("inputs/06-orbit-map.txt")));
+    answers.push_back(solve("orbit::transfer_count", {orbits_input.hash}, [orbits](std::pmr::memory_resource* resource) -> Answer
+    {
+        return orbit::transfer_count(orbits.get(), resource);
+    }));
 
     std::ofstream writer("output.txt");
     for(uint16_t part = 0; part < answers.size(); ++part)
     {
-        std::visit([&part, &writer](auto&& answer)
+        auto solution = answers[part].get();
+
+        std::visit([&part, &writer, &solution](auto&& answer)
         {
             std::stringstream output;
             output << "Part " << std::floor(part / 2) + 1 << '.' << part % 2 << ": " << answer;
 
-            std::cout << output.str() << std::endl;
+            std::cout << output.str() << " (" << std::fixed << std::setprecision(3) << solution.latency << " ms, " << solution.allocation_count << " allocations, " << solution.allocated_bytes << " bytes, " << solution.peak_bytes << " bytes at peak)" << std::endl;
 
             if(writer)
             {
-                writer << output.str() << '\n';
+                writer << output.str() << '\n' << std::flush;
             }
-        }, answers[part]);
+        }, solution.answer);
     }
 
     if(writer)
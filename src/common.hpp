@@ -0,0 +1,971 @@
+#ifndef ADVENT_OF_CODE_COMMON_HPP
+#define ADVENT_OF_CODE_COMMON_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include <iostream>
+#include <cstdint>
+#include <fstream>
+#include <filesystem>
+#include <cmath>
+#include <variant>
+#include <map>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <array>
+#include <algorithm>
+#include <thread>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <memory>
+#include <optional>
+#include <atomic>
+#include <memory_resource>
+#include <string_view>
+#include <charconv>
+#include <iterator>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <limits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////
+// Helpers
+/////////////////////////////////////////////////
+/////////////////////////////////////////////////
+inline size_t hardware_threads()
+{
+    static const size_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+    return thread_count;
+}
+
+/////////////////////////////////////////////////
+/// \brief Fixed set of threads running the
+/// submitted tasks in submission order
+///
+/////////////////////////////////////////////////
+class ThreadPool
+{
+public:
+    /////////////////////////////////////////////////
+    explicit ThreadPool(size_t thread_count = hardware_threads())
+    {
+        for(size_t worker = 0; worker < std::max<size_t>(thread_count, 1); ++worker)
+        {
+            m_workers.emplace_back([this]()
+            {
+                while(true)
+                {
+                    std::function<void()> task;
+
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_condition.wait(lock, [this]()
+                        {
+                            return m_stopping || !m_tasks.empty();
+                        });
+
+                        if(m_tasks.empty())
+                        {
+                            return;
+                        }
+
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop();
+                    }
+
+                    task();
+                }
+            });
+        }
+    }
+
+    /////////////////////////////////////////////////
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+
+        m_condition.notify_all();
+
+        for(auto& worker: m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    /////////////////////////////////////////////////
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /////////////////////////////////////////////////
+    /// \brief Queues a task, which may wait for the
+    /// result of any task submitted before it
+    ///
+    /////////////////////////////////////////////////
+    template <typename Function>
+    std::future<std::invoke_result_t<Function>> submit(Function&& function)
+    {
+        auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Function>()>>(std::forward<Function>(function));
+        auto result = task->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace([task]()
+            {
+                (*task)();
+            });
+        }
+
+        m_condition.notify_one();
+
+        return result;
+    }
+
+private:
+    /////////////////////////////////////////////////
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping = false;
+};
+
+/////////////////////////////////////////////////
+/// \brief Memory resource forwarding to another
+/// one while counting the allocations, the bytes
+/// allocated and the peak of bytes in use
+///
+/////////////////////////////////////////////////
+class TrackingResource : public std::pmr::memory_resource
+{
+public:
+    /////////////////////////////////////////////////
+    explicit TrackingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) :
+    m_upstream(upstream)
+    {
+    }
+
+    /////////////////////////////////////////////////
+    size_t allocation_count() const
+    {
+        return m_allocation_count;
+    }
+
+    /////////////////////////////////////////////////
+    size_t allocated_bytes() const
+    {
+        return m_allocated_bytes;
+    }
+
+    /////////////////////////////////////////////////
+    size_t peak_bytes() const
+    {
+        return m_peak_bytes;
+    }
+
+protected:
+    /////////////////////////////////////////////////
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        void* address = m_upstream->allocate(bytes, alignment);
+
+        ++m_allocation_count;
+        m_allocated_bytes += bytes;
+
+        size_t used_bytes = m_used_bytes += bytes;
+        size_t peak_bytes = m_peak_bytes;
+
+        while(used_bytes > peak_bytes && !m_peak_bytes.compare_exchange_weak(peak_bytes, used_bytes))
+        {
+        }
+
+        return address;
+    }
+
+    /////////////////////////////////////////////////
+    void do_deallocate(void* address, size_t bytes, size_t alignment) override
+    {
+        m_upstream->deallocate(address, bytes, alignment);
+        m_used_bytes -= bytes;
+    }
+
+    /////////////////////////////////////////////////
+    bool do_is_equal(const std::pmr::memory_resource& another_resource) const noexcept override
+    {
+        return this == &another_resource;
+    }
+
+private:
+    /////////////////////////////////////////////////
+    std::pmr::memory_resource* m_upstream;
+    std::atomic<size_t> m_allocation_count = 0;
+    std::atomic<size_t> m_allocated_bytes = 0;
+    std::atomic<size_t> m_used_bytes = 0;
+    std::atomic<size_t> m_peak_bytes = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Read-only view over the whole content
+/// of a file, memory-mapped when the platform
+/// allows it
+///
+/////////////////////////////////////////////////
+class MappedFile
+{
+public:
+    /////////////////////////////////////////////////
+    explicit MappedFile(const std::filesystem::path& path) :
+    m_path(path)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+
+        if(descriptor < 0)
+        {
+            return;
+        }
+
+        struct stat status;
+        if(::fstat(descriptor, &status) == 0 && status.st_size > 0)
+        {
+            void* address = ::mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+            if(address != MAP_FAILED)
+            {
+                ::madvise(address, status.st_size, MADV_SEQUENTIAL);
+                m_content = {static_cast<const char*>(address), size_t(status.st_size)};
+                m_mapped = true;
+            }
+        }
+
+        ::close(descriptor);
+#endif
+
+        if(!m_mapped)
+        {
+            std::ifstream reader(path, std::ios::binary);
+
+            if(reader)
+            {
+                m_fallback.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
+                m_content = m_fallback;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////
+    ~MappedFile()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if(m_mapped)
+        {
+            ::munmap(const_cast<char*>(m_content.data()), m_content.size());
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /////////////////////////////////////////////////
+    std::string_view content() const
+    {
+        return m_content;
+    }
+
+    /////////////////////////////////////////////////
+    const std::filesystem::path& path() const
+    {
+        return m_path;
+    }
+
+private:
+    /////////////////////////////////////////////////
+    std::filesystem::path m_path;
+    std::string_view m_content;
+    std::string m_fallback;
+    bool m_mapped = false;
+};
+
+/////////////////////////////////////////////////
+/// \brief Zero-copy range over the tokens of a
+/// text, split on any of the given delimiters
+///
+/////////////////////////////////////////////////
+class Tokens
+{
+public:
+    /////////////////////////////////////////////////
+    static constexpr std::string_view whitespaces = " \t\r\n";
+    static constexpr std::string_view commas = ", \t\r\n";
+    static constexpr std::string_view lines = "\r\n";
+
+    /////////////////////////////////////////////////
+    class Iterator
+    {
+    public:
+        /////////////////////////////////////////////////
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        /////////////////////////////////////////////////
+        Iterator(std::string_view remaining, std::string_view delimiters) :
+        m_remaining(remaining),
+        m_delimiters(delimiters)
+        {
+            ++*this;
+        }
+
+        /////////////////////////////////////////////////
+        Iterator& operator++()
+        {
+            size_t begin = m_remaining.find_first_not_of(m_delimiters);
+
+            if(begin == std::string_view::npos)
+            {
+                m_remaining = {};
+                m_token = {};
+                return *this;
+            }
+
+            size_t end = std::min(m_remaining.find_first_of(m_delimiters, begin), m_remaining.size());
+
+            m_token = m_remaining.substr(begin, end - begin);
+            m_remaining.remove_prefix(end);
+
+            return *this;
+        }
+
+        /////////////////////////////////////////////////
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        /////////////////////////////////////////////////
+        reference operator*() const
+        {
+            return m_token;
+        }
+
+        /////////////////////////////////////////////////
+        pointer operator->() const
+        {
+            return &m_token;
+        }
+
+        /////////////////////////////////////////////////
+        bool operator==(const Iterator& another_iterator) const
+        {
+            return m_token.data() == another_iterator.m_token.data() && m_token.size() == another_iterator.m_token.size();
+        }
+
+        /////////////////////////////////////////////////
+        bool operator!=(const Iterator& another_iterator) const
+        {
+            return !(*this == another_iterator);
+        }
+
+    private:
+        /////////////////////////////////////////////////
+        std::string_view m_remaining;
+        std::string_view m_delimiters;
+        std::string_view m_token;
+    };
+
+    /////////////////////////////////////////////////
+    Tokens(std::string_view content, std::string_view delimiters = whitespaces) :
+    m_content(content),
+    m_delimiters(delimiters)
+    {
+    }
+
+    /////////////////////////////////////////////////
+    Iterator begin() const
+    {
+        return {m_content, m_delimiters};
+    }
+
+    /////////////////////////////////////////////////
+    Iterator end() const
+    {
+        return {{}, m_delimiters};
+    }
+
+private:
+    /////////////////////////////////////////////////
+    std::string_view m_content;
+    std::string_view m_delimiters;
+};
+
+/////////////////////////////////////////////////
+/// \brief Parses every integer of a text into a
+/// buffer, separated by whitespaces or commas
+///
+/// Tokens that are not entirely an integer, or
+/// that are out of the range of the buffer type,
+/// are skipped as a whole.
+///
+/// \return Number of tokens skipped
+///
+/////////////////////////////////////////////////
+template <typename Container>
+size_t parse_integers(std::string_view content, Container& buffer)
+{
+    using Type = typename Container::value_type;
+
+    static_assert(std::is_integral<Type>::value, "parse_integers requires an integral type");
+
+    // A lookup table instead of Tokens, whose find_first_of scans the delimiters for every character
+    static constexpr auto delimiters = []
+    {
+        std::array<bool, 256> table = {};
+
+        for(char delimiter: Tokens::commas)
+        {
+            table[static_cast<unsigned char>(delimiter)] = true;
+        }
+
+        return table;
+    }();
+
+    auto is_delimiter = [](char character)
+    {
+        return delimiters[static_cast<unsigned char>(character)];
+    };
+
+    buffer.clear();
+    buffer.reserve(std::count_if(content.begin(), content.end(), is_delimiter) + 1);
+
+    size_t skipped_count = 0;
+    const char* cursor = content.data();
+    const char* end = content.data() + content.size();
+
+    while(cursor != end)
+    {
+        if(is_delimiter(*cursor))
+        {
+            ++cursor;
+            continue;
+        }
+
+        Type value = 0;
+        auto [stop, error] = std::from_chars(cursor, end, value);
+
+        if(error != std::errc() || (stop != end && !is_delimiter(*stop)))
+        {
+            ++skipped_count;
+            cursor = std::find_if(cursor, end, is_delimiter);
+            continue;
+        }
+
+        buffer.push_back(value);
+        cursor = stop;
+    }
+
+    return skipped_count;
+}
+
+/////////////////////////////////////////////////
+template <typename Container>
+void get_input_list(const MappedFile& file, Container& input_list)
+{
+    input_list.clear();
+
+    if constexpr(std::is_integral<typename Container::value_type>::value)
+    {
+        if(size_t skipped_count = parse_integers(file.content(), input_list); skipped_count > 0)
+        {
+            std::cerr << "Skipped " << skipped_count << " malformed or out of range integer(s) in " << file.path() << std::endl;
+        }
+    }
+    else
+    {
+        for(auto token: Tokens(file.content()))
+        {
+            input_list.emplace_back(token);
+        }
+    }
+}
+
+/////////////////////////////////////////////////
+template <typename Container>
+void get_input_list(const std::filesystem::path& path, Container& input_list)
+{
+    get_input_list(MappedFile(path), input_list);
+}
+
+/////////////////////////////////////////////////
+template <typename Type>
+std::vector<Type> get_input_list(const MappedFile& file)
+{
+    std::vector<Type> input_list;
+    get_input_list(file, input_list);
+    return input_list;
+}
+
+/////////////////////////////////////////////////
+template <typename Type>
+std::vector<Type> get_input_list(const std::filesystem::path& path)
+{
+    return get_input_list<Type>(MappedFile(path));
+}
+
+/////////////////////////////////////////////////
+/// \brief 64-bit FNV-1a hash of a content, which
+/// can be chained through its seed
+///
+/////////////////////////////////////////////////
+inline uint64_t content_hash(std::string_view content, uint64_t seed = 14695981039346656037ull)
+{
+    uint64_t hash = seed;
+
+    for(unsigned char character: content)
+    {
+        hash = (hash ^ character) * 1099511628211ull;
+    }
+
+    return hash;
+}
+
+/////////////////////////////////////////////////
+/// \brief Struct representing instructions for
+/// an Intcode program
+///
+/////////////////////////////////////////////////
+struct Sentence
+{
+    /////////////////////////////////////////////////
+    int64_t noun = 0;
+    int64_t verb = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Struct representing a vector or a point
+/// by its coordinates in a 2D dimension
+///
+/////////////////////////////////////////////////
+template <typename Type>
+struct Vector2
+{
+    /////////////////////////////////////////////////
+    Type x;
+    Type y;
+
+    /////////////////////////////////////////////////
+    Type standard() const
+    {
+        return std::abs(x) + std::abs(y);
+    }
+
+    /////////////////////////////////////////////////
+    bool operator==(const Vector2& another_vector) const
+    {
+        return (x == another_vector.x && y == another_vector.y);
+    }
+};
+
+/////////////////////////////////////////////////
+inline std::ostream& operator<<(std::ostream& stream, const Sentence& sentence)
+{
+    return stream << sentence.noun << ',' << sentence.verb;
+}
+
+/////////////////////////////////////////////////
+template <typename Type>
+std::ostream& operator<<(std::ostream& stream, const Vector2<Type>& vector)
+{
+    return stream << vector.x << ',' << vector.y;
+}
+
+/////////////////////////////////////////////////
+/// \brief Struct representing a vector or a point
+/// by its coordinates in a 3D dimension
+///
+/////////////////////////////////////////////////
+template <typename Type>
+struct Vector3
+{
+    /////////////////////////////////////////////////
+    Type x;
+    Type y;
+    Type z;
+};
+
+/////////////////////////////////////////////////
+/// \brief Open-addressing hash map from points to
+/// integers, keeping the first value inserted for
+/// each point
+///
+/// Coordinates are packed in a single 64-bit key,
+/// which requires them to fit in 32 bits, and the
+/// point with both coordinates at their minimum is
+/// reserved to mark empty slots. Keys are probed by
+/// groups of contiguous slots and spread over
+/// shards that can be filled in parallel.
+///
+/////////////////////////////////////////////////
+template <typename Type>
+class Vector2Map
+{
+public:
+    /////////////////////////////////////////////////
+    static constexpr size_t group_size = 8;
+    static constexpr uint64_t empty_key = 0x8000000080000000ull;
+
+    /////////////////////////////////////////////////
+    explicit Vector2Map(size_t expected_count, size_t shard_count = 1, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+    m_shards(resource)
+    {
+        while((size_t(1) << m_shard_bits) < shard_count)
+        {
+            ++m_shard_bits;
+        }
+
+        m_shards.reserve(size_t(1) << m_shard_bits);
+
+        for(size_t shard = 0; shard < (size_t(1) << m_shard_bits); ++shard)
+        {
+            m_shards.emplace_back(expected_count >> m_shard_bits, resource);
+        }
+    }
+
+    /////////////////////////////////////////////////
+    static bool representable(const Vector2<Type>& point)
+    {
+        constexpr Type minimum = std::numeric_limits<int32_t>::min();
+        constexpr Type maximum = std::numeric_limits<int32_t>::max();
+
+        return point.x >= minimum && point.x <= maximum && point.y >= minimum && point.y <= maximum && !(point.x == minimum && point.y == minimum);
+    }
+
+    /////////////////////////////////////////////////
+    /// \throw std::out_of_range if the point cannot
+    /// be represented in a key
+    ///
+    /////////////////////////////////////////////////
+    static uint64_t pack(const Vector2<Type>& point)
+    {
+        if(!representable(point))
+        {
+            throw std::out_of_range("Vector2Map point out of the 32 bits range");
+        }
+
+        return (uint64_t(uint32_t(point.x)) << 32) | uint32_t(point.y);
+    }
+
+    /////////////////////////////////////////////////
+    /// \return False if the point was already there,
+    /// in which case its value is left unchanged
+    ///
+    /////////////////////////////////////////////////
+    bool insert(const Vector2<Type>& point, int64_t value)
+    {
+        uint64_t key = pack(point);
+        uint64_t key_hash = hash(key);
+
+        return m_shards[shard_index(key_hash)].insert(key, key_hash, value);
+    }
+
+    /////////////////////////////////////////////////
+    std::optional<int64_t> find(const Vector2<Type>& point) const
+    {
+        if(!representable(point))
+        {
+            return std::nullopt;
+        }
+
+        uint64_t key = pack(point);
+        uint64_t key_hash = hash(key);
+
+        return m_shards[shard_index(key_hash)].find(key, key_hash);
+    }
+
+    /////////////////////////////////////////////////
+    /// \brief Inserts every point of a path with
+    /// its step, starting from 1, so that each point
+    /// keeps the step of its first visit
+    ///
+    /// The path is first partitioned by shard in a
+    /// single pass that keeps its order, then each
+    /// thread fills its own shards from their part.
+    /// Every shard is sized for its part before the
+    /// threads start, so that they never allocate
+    /// and the resource needs not be thread-safe.
+    /// Each spawned std::thread still allocates its
+    /// state from the global operator new.
+    ///
+    /////////////////////////////////////////////////
+    void insert_steps(const Vector2<Type>* points, size_t count, size_t thread_count = hardware_threads())
+    {
+        thread_count = std::clamp<size_t>(thread_count, 1, m_shards.size());
+
+        if(thread_count == 1 || count < (1 << 16))
+        {
+            for(size_t step = 0; step < count; ++step)
+            {
+                insert(points[step], step + 1);
+            }
+
+            return;
+        }
+
+        auto resource = m_shards.get_allocator().resource();
+
+        std::pmr::vector<size_t> offsets(m_shards.size() + 1, 0, resource);
+        std::pmr::vector<uint64_t> keys(count, resource);
+
+        for(size_t step = 0; step < count; ++step)
+        {
+            keys[step] = pack(points[step]);
+            ++offsets[shard_index(hash(keys[step])) + 1];
+        }
+
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        std::pmr::vector<std::pair<uint64_t, int64_t>> entries(count, resource);
+        std::pmr::vector<size_t> positions(offsets.begin(), offsets.end() - 1, resource);
+
+        for(size_t step = 0; step < count; ++step)
+        {
+            entries[positions[shard_index(hash(keys[step]))]++] = {keys[step], step + 1};
+        }
+
+        for(size_t shard = 0; shard < m_shards.size(); ++shard)
+        {
+            m_shards[shard].reserve(m_shards[shard].count + offsets[shard + 1] - offsets[shard]);
+        }
+
+        auto fill = [this, &offsets, &entries](size_t first_shard, size_t end_shard)
+        {
+            for(size_t shard = first_shard; shard < end_shard; ++shard)
+            {
+                for(size_t entry = offsets[shard]; entry < offsets[shard + 1]; ++entry)
+                {
+                    m_shards[shard].insert(entries[entry].first, hash(entries[entry].first), entries[entry].second);
+                }
+            }
+        };
+
+        std::pmr::vector<std::thread> workers(resource);
+        workers.reserve(thread_count);
+
+        size_t share = (m_shards.size() + thread_count - 1) / thread_count;
+
+        for(size_t first_shard = 0; first_shard < m_shards.size(); first_shard += share)
+        {
+            workers.emplace_back(fill, first_shard, std::min(m_shards.size(), first_shard + share));
+        }
+
+        for(auto& worker: workers)
+        {
+            worker.join();
+        }
+    }
+
+    /////////////////////////////////////////////////
+    size_t size() const
+    {
+        size_t count = 0;
+
+        for(const auto& shard: m_shards)
+        {
+            count += shard.count;
+        }
+
+        return count;
+    }
+
+private:
+    /////////////////////////////////////////////////
+    static uint64_t hash(uint64_t key)
+    {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDull;
+        return key ^ (key >> 33);
+    }
+
+    /////////////////////////////////////////////////
+    size_t shard_index(uint64_t key_hash) const
+    {
+        return m_shard_bits == 0 ? 0 : key_hash >> (64 - m_shard_bits);
+    }
+
+    /////////////////////////////////////////////////
+    static size_t first_bit(uint32_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask);
+#else
+        size_t bit = 0;
+        while(!(mask & 1))
+        {
+            mask >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    /////////////////////////////////////////////////
+    struct Shard
+    {
+        /////////////////////////////////////////////////
+        std::pmr::vector<uint64_t> keys;
+        std::pmr::vector<int64_t> values;
+        size_t group_mask = 0;
+        size_t count = 0;
+
+        /////////////////////////////////////////////////
+        Shard(size_t expected_count, std::pmr::memory_resource* resource) :
+        keys(resource),
+        values(resource)
+        {
+            size_t group_count = 1;
+            while(group_count * group_size < expected_count * 2)
+            {
+                group_count *= 2;
+            }
+
+            allocate(group_count);
+        }
+
+        /////////////////////////////////////////////////
+        void allocate(size_t group_count)
+        {
+            keys.assign(group_count * group_size, empty_key);
+            values.assign(group_count * group_size, 0);
+            group_mask = group_count - 1;
+            count = 0;
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Grows until the given count of keys
+        /// fits without growing again
+        ///
+        /////////////////////////////////////////////////
+        void reserve(size_t expected_count)
+        {
+            while(expected_count * 4 > keys.size() * 3)
+            {
+                grow();
+            }
+        }
+
+        /////////////////////////////////////////////////
+        /// \brief Compares a group of keys at once,
+        /// giving the masks of its matching and empty
+        /// slots
+        ///
+        /////////////////////////////////////////////////
+        Vector2<uint32_t> probe(size_t group, uint64_t key) const
+        {
+            const uint64_t* slots = keys.data() + group * group_size;
+
+            Vector2<uint32_t> masks = {0, 0};
+
+            for(size_t slot = 0; slot < group_size; ++slot)
+            {
+                masks.x |= uint32_t(slots[slot] == key) << slot;
+                masks.y |= uint32_t(slots[slot] == empty_key) << slot;
+            }
+
+            return masks;
+        }
+
+        /////////////////////////////////////////////////
+        std::optional<int64_t> find(uint64_t key, uint64_t key_hash) const
+        {
+            for(size_t group = key_hash & group_mask;; group = (group + 1) & group_mask)
+            {
+                auto masks = probe(group, key);
+
+                if(masks.x)
+                {
+                    return values[group * group_size + first_bit(masks.x)];
+                }
+
+                if(masks.y)
+                {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////
+        bool insert(uint64_t key, uint64_t key_hash, int64_t value)
+        {
+            if((count + 1) * 4 > keys.size() * 3)
+            {
+                grow();
+            }
+
+            for(size_t group = key_hash & group_mask;; group = (group + 1) & group_mask)
+            {
+                auto masks = probe(group, key);
+
+                if(masks.x)
+                {
+                    return false;
+                }
+
+                if(masks.y)
+                {
+                    size_t slot = group * group_size + first_bit(masks.y);
+
+                    keys[slot] = key;
+                    values[slot] = value;
+                    ++count;
+
+                    return true;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////
+        void grow()
+        {
+            std::pmr::vector<uint64_t> previous_keys(std::move(keys));
+            std::pmr::vector<int64_t> previous_values(std::move(values));
+
+            keys = std::pmr::vector<uint64_t>(previous_keys.get_allocator());
+            values = std::pmr::vector<int64_t>(previous_values.get_allocator());
+
+            allocate((group_mask + 1) * 2);
+
+            for(size_t slot = 0; slot < previous_keys.size(); ++slot)
+            {
+                if(previous_keys[slot] != empty_key)
+                {
+                    insert(previous_keys[slot], hash(previous_keys[slot]), previous_values[slot]);
+                }
+            }
+        }
+    };
+
+    /////////////////////////////////////////////////
+    size_t m_shard_bits = 0;
+    std::pmr::vector<Shard> m_shards;
+};
+
+#endif // ADVENT_OF_CODE_COMMON_HPP
@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "fuel.hpp"
+
+/////////////////////////////////////////////////
+namespace fuel
+{
+/////////////////////////////////////////////////
+int64_t calculator(int64_t mass)
+{
+    return mass / 3 - 2;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> scalar_requirement(const int64_t* masses, size_t count)
+{
+    Vector2<int64_t> requirements = {0, 0};
+
+    for(size_t position = 0; position < count; ++position)
+    {
+        auto remaining_mass = calculator(masses[position]);
+        requirements.x += remaining_mass;
+
+        while(remaining_mass > 0)
+        {
+            requirements.y += remaining_mass;
+            remaining_mass = calculator(remaining_mass);
+        }
+    }
+
+    return requirements;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> block_requirement(const int64_t* masses, size_t count)
+{
+    std::array<int64_t, lane_count> fuel = {};
+    std::array<int64_t, lane_count> total_fuel = {};
+
+    Vector2<int64_t> requirements = {0, 0};
+
+    size_t position = 0;
+    for(; position + lane_count <= count; position += lane_count)
+    {
+        uint64_t out_of_range = 0;
+
+        for(size_t lane = 0; lane < lane_count; ++lane)
+        {
+            out_of_range |= uint64_t(masses[position + lane]) > uint64_t(std::numeric_limits<int32_t>::max());
+        }
+
+        if(out_of_range)
+        {
+            auto group = scalar_requirement(masses + position, lane_count);
+
+            requirements.x += group.x;
+            requirements.y += group.y;
+            continue;
+        }
+
+        std::array<int32_t, lane_count> remaining_mass;
+        std::array<int32_t, lane_count> group_total_fuel = {};
+
+        for(size_t lane = 0; lane < lane_count; ++lane)
+        {
+            remaining_mass[lane] = int32_t(masses[position + lane]) / 3 - 2;
+            fuel[lane] += remaining_mass[lane];
+        }
+
+        for(size_t depth = 0; depth < max_fuel_depth; ++depth)
+        {
+            int32_t active = 0;
+
+            for(size_t lane = 0; lane < lane_count; ++lane)
+            {
+                int32_t positive_mass = std::max(remaining_mass[lane], 0);
+                group_total_fuel[lane] += positive_mass;
+                remaining_mass[lane] = positive_mass / 3 - 2;
+                active |= remaining_mass[lane] > 0;
+            }
+
+            if(!active)
+            {
+                break;
+            }
+        }
+
+        for(size_t lane = 0; lane < lane_count; ++lane)
+        {
+            total_fuel[lane] += group_total_fuel[lane];
+        }
+    }
+
+    for(size_t lane = 0; lane < lane_count; ++lane)
+    {
+        requirements.x += fuel[lane];
+        requirements.y += total_fuel[lane];
+    }
+
+    auto remaining = scalar_requirement(masses + position, count - position);
+
+    requirements.x += remaining.x;
+    requirements.y += remaining.y;
+
+    return requirements;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> parallel_requirement(const int64_t* masses, size_t count, size_t thread_count, std::pmr::memory_resource* resource)
+{
+    if(count == 0)
+    {
+        return {0, 0};
+    }
+
+    thread_count = std::clamp<size_t>(thread_count, 1, (count + block_size - 1) / block_size);
+
+    if(thread_count <= 1)
+    {
+        return block_requirement(masses, count);
+    }
+
+    std::pmr::vector<Vector2<int64_t>> partial_requirements(thread_count, {0, 0}, resource);
+    std::pmr::vector<std::thread> workers(resource);
+    workers.reserve(thread_count);
+
+    size_t share = (count + thread_count - 1) / thread_count;
+
+    for(size_t worker = 0; worker < thread_count; ++worker)
+    {
+        size_t begin = std::min(count, worker * share);
+        size_t end = std::min(count, begin + share);
+
+        workers.emplace_back([&partial_requirements, masses, worker, begin, end]()
+        {
+            partial_requirements[worker] = block_requirement(masses + begin, end - begin);
+        });
+    }
+
+    Vector2<int64_t> requirements = {0, 0};
+
+    for(size_t worker = 0; worker < thread_count; ++worker)
+    {
+        workers[worker].join();
+
+        requirements.x += partial_requirements[worker].x;
+        requirements.y += partial_requirements[worker].y;
+    }
+
+    return requirements;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> stream_requirement(std::istream& reader, size_t thread_count, std::pmr::memory_resource* resource)
+{
+    thread_count = std::max<size_t>(thread_count, 1);
+
+    // Chunks start small for short streams and double up to a few blocks per thread
+    const size_t max_chunk_size = block_size * thread_count * 8;
+    size_t chunk_size = 1 << 12;
+
+    std::pmr::string text(resource);
+    std::pmr::vector<int64_t> masses(resource);
+
+    Vector2<int64_t> requirements = {0, 0};
+
+    size_t skipped_count = 0;
+    size_t carried_size = 0;
+    bool last_chunk = false;
+
+    while(!last_chunk)
+    {
+        text.resize(carried_size + chunk_size);
+        reader.read(text.data() + carried_size, chunk_size);
+
+        size_t size = carried_size + size_t(reader.gcount());
+        last_chunk = !reader;
+
+        // The token cut at the end of the chunk is carried over to the next one
+        std::string_view content(text.data(), size);
+        size_t end = last_chunk ? size : content.find_last_of(Tokens::commas) + 1;
+
+        skipped_count += parse_integers(content.substr(0, end), masses);
+
+        auto block = parallel_requirement(masses.data(), masses.size(), thread_count, resource);
+
+        requirements.x += block.x;
+        requirements.y += block.y;
+
+        carried_size = size - end;
+        std::copy(text.begin() + end, text.begin() + size, text.begin());
+
+        chunk_size = std::min(chunk_size * 2, max_chunk_size);
+    }
+
+    if(skipped_count > 0)
+    {
+        std::cerr << "Skipped " << skipped_count << " malformed or out of range integer(s) in the mass stream" << std::endl;
+    }
+
+    return requirements;
+}
+
+/////////////////////////////////////////////////
+int64_t requirement(const std::vector<int64_t>& inputs, std::pmr::memory_resource* resource)
+{
+    return parallel_requirement(inputs.data(), inputs.size(), hardware_threads(), resource).x;
+}
+
+/////////////////////////////////////////////////
+int64_t total_requirement(const std::vector<int64_t>& inputs, std::pmr::memory_resource* resource)
+{
+    return parallel_requirement(inputs.data(), inputs.size(), hardware_threads(), resource).y;
+}
+
+} // namespace fuel
@@ -0,0 +1,73 @@
+#ifndef ADVENT_OF_CODE_FUEL_HPP
+#define ADVENT_OF_CODE_FUEL_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "common.hpp"
+#include <istream>
+
+/////////////////////////////////////////////////
+/// \brief Fuel required by modules of given masses,
+/// computed on vectorizable lanes split between
+/// threads (day 1)
+///
+/////////////////////////////////////////////////
+namespace fuel
+{
+/////////////////////////////////////////////////
+constexpr size_t lane_count = 64;
+constexpr size_t block_size = 1 << 16;
+constexpr size_t max_fuel_depth = 20;
+
+/////////////////////////////////////////////////
+int64_t calculator(int64_t mass);
+
+/////////////////////////////////////////////////
+Vector2<int64_t> scalar_requirement(const int64_t* masses, size_t count);
+
+/////////////////////////////////////////////////
+/// \brief Computes both the simple and the total
+/// fuel requirement of a block of masses, on 32-bit
+/// lanes so that the divisions by 3 are vectorized
+///
+/// Groups holding a mass outside of the 32-bit
+/// range fall back to the scalar computation. The
+/// fuel of a 32-bit mass recurses at most 20 times.
+///
+/////////////////////////////////////////////////
+Vector2<int64_t> block_requirement(const int64_t* masses, size_t count);
+
+/////////////////////////////////////////////////
+/// \brief Splits the masses between the threads
+/// and reduces their block requirements
+///
+/// Only one thread runs below a block per thread.
+/// Everything else comes from the resource, but
+/// each spawned std::thread allocates its state
+/// from the global operator new.
+///
+/////////////////////////////////////////////////
+Vector2<int64_t> parallel_requirement(const int64_t* masses, size_t count, size_t thread_count = hardware_threads(), std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+/// \brief Reads the masses from any stream by
+/// fixed-size blocks, so that the whole dataset
+/// never has to be loaded in memory
+///
+/// Blocks are parsed like get_input_list does,
+/// skipping and reporting the tokens that are not
+/// integers instead of stopping on them.
+///
+/////////////////////////////////////////////////
+Vector2<int64_t> stream_requirement(std::istream& reader, size_t thread_count = hardware_threads(), std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+int64_t requirement(const std::vector<int64_t>& inputs, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+int64_t total_requirement(const std::vector<int64_t>& inputs, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+} // namespace fuel
+
+#endif // ADVENT_OF_CODE_FUEL_HPP
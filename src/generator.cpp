@@ -0,0 +1,224 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "generator.hpp"
+
+/////////////////////////////////////////////////
+namespace generator
+{
+/////////////////////////////////////////////////
+std::vector<int64_t> masses(uint64_t seed, size_t count)
+{
+    std::mt19937_64 random(seed);
+    std::uniform_int_distribution<int64_t> mass(1, 1000000000);
+
+    std::vector<int64_t> inputs(count);
+    for(auto& input: inputs)
+    {
+        input = mass(random);
+    }
+
+    return inputs;
+}
+
+/////////////////////////////////////////////////
+std::vector<std::string> wire(uint64_t seed, size_t segment_count, int64_t max_length)
+{
+    std::mt19937_64 random(seed);
+    std::uniform_int_distribution<int64_t> length(1, max_length);
+
+    constexpr std::array<char, 4> directions = {'L', 'U', 'R', 'D'};
+
+    std::vector<std::string> segments(segment_count);
+    for(auto& segment: segments)
+    {
+        segment = directions[random() % directions.size()] + std::to_string(length(random));
+    }
+
+    return segments;
+}
+
+/////////////////////////////////////////////////
+std::vector<std::string> orbits(uint64_t seed, size_t body_count, size_t width)
+{
+    constexpr std::string_view alphabet = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    body_count = std::max<size_t>(body_count, 3);
+    width = std::max<size_t>(width, 1);
+
+    std::vector<std::string> names = {"COM"};
+    names.reserve(body_count);
+
+    for(size_t index = 0; names.size() < body_count - 2; ++index)
+    {
+        size_t length = 3;
+        size_t first_index = 0;
+        size_t name_count = alphabet.size() * alphabet.size() * alphabet.size();
+
+        while(index - first_index >= name_count)
+        {
+            first_index += name_count;
+            name_count *= alphabet.size();
+            ++length;
+        }
+
+        std::string name(length, alphabet[0]);
+        for(size_t digit = length, value = index - first_index; digit-- > 0; value /= alphabet.size())
+        {
+            name[digit] = alphabet[value % alphabet.size()];
+        }
+
+        if(name != "COM" && name != "YOU" && name != "SAN")
+        {
+            names.push_back(name);
+        }
+    }
+
+    names.push_back("YOU");
+    names.push_back("SAN");
+
+    std::mt19937_64 random(seed);
+    std::vector<std::string> inputs;
+    inputs.reserve(body_count - 1);
+
+    for(size_t body = 1; body < names.size(); ++body)
+    {
+        size_t first_parent = body > width ? body - width : 0;
+        size_t parent = first_parent + random() % (body - first_parent);
+
+        if(body >= names.size() - 2)
+        {
+            parent = random() % (names.size() - 2);
+        }
+
+        inputs.push_back(names[parent] + ')' + names[body]);
+    }
+
+    std::shuffle(inputs.begin(), inputs.end(), random);
+
+    return inputs;
+}
+
+/////////////////////////////////////////////////
+Program intcode_loop(uint64_t seed, size_t body_size, int64_t loop_count)
+{
+    std::mt19937_64 random(seed);
+    std::uniform_int_distribution<int64_t> constant(-1000, 1000);
+
+    enum Cell : int64_t
+    {
+        Counter,
+        Accumulator,
+        Flag
+    };
+
+    Program program;
+    program.loop_count = std::max<int64_t>(loop_count, 1);
+
+    auto& integers = program.integers;
+    std::vector<std::pair<size_t, Cell>> cell_operands;
+
+    auto cell = [&integers, &cell_operands](Cell name)
+    {
+        cell_operands.push_back({integers.size(), name});
+        integers.push_back(0);
+    };
+
+    integers.push_back(3);
+    cell(Counter);
+    integers.insert(integers.end(), {1101, 0, 0});
+    cell(Accumulator);
+
+    int64_t loop_address = integers.size();
+    int64_t body_result = 0;
+
+    for(size_t instruction = 0; instruction < body_size; ++instruction)
+    {
+        auto first = constant(random);
+        auto second = constant(random);
+
+        switch(random() % 5)
+        {
+        case 0:
+            integers.push_back(1001);
+            cell(Accumulator);
+            integers.push_back(first);
+            cell(Accumulator);
+            body_result += first;
+            continue;
+        case 1:
+            integers.insert(integers.end(), {1107, first, second});
+            body_result += first < second;
+            break;
+        case 2:
+            integers.insert(integers.end(), {1102, first, second});
+            body_result += first * second;
+            break;
+        case 3:
+            // Jumps over an addition when its condition is zero, falls through to the next instruction otherwise
+            if(first % 2)
+            {
+                integers.insert(integers.end(), {1106, 0, int64_t(integers.size()) + 7, 1001});
+                cell(Accumulator);
+                integers.push_back(second);
+                cell(Accumulator);
+            }
+            else
+            {
+                integers.insert(integers.end(), {1106, first == 0 ? 1 : first, 0});
+            }
+            continue;
+        default:
+            integers.insert(integers.end(), {1108, first, first});
+            body_result += 1;
+            break;
+        }
+
+        cell(Flag);
+        integers.push_back(1);
+        cell(Accumulator);
+        cell(Flag);
+        cell(Accumulator);
+    }
+
+    integers.push_back(1001);
+    cell(Counter);
+    integers.push_back(-1);
+    cell(Counter);
+    integers.push_back(1005);
+    cell(Counter);
+    integers.push_back(loop_address);
+    integers.push_back(4);
+    cell(Accumulator);
+    integers.push_back(99);
+
+    int64_t data_address = integers.size();
+    integers.insert(integers.end(), {0, 0, 0});
+
+    for(auto [position, name]: cell_operands)
+    {
+        integers[position] = data_address + name;
+    }
+
+    program.diagnostic_code = body_result * program.loop_count;
+
+    return program;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> password_range(uint64_t seed)
+{
+    std::mt19937_64 random(seed);
+    std::uniform_int_distribution<int64_t> number(100000, 999999);
+
+    Vector2<int64_t> range = {number(random), number(random)};
+
+    if(range.x > range.y)
+    {
+        std::swap(range.x, range.y);
+    }
+
+    return range;
+}
+
+} // namespace generator
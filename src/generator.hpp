@@ -0,0 +1,121 @@
+#ifndef ADVENT_OF_CODE_GENERATOR_HPP
+#define ADVENT_OF_CODE_GENERATOR_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "common.hpp"
+#include <random>
+#include <streambuf>
+
+/////////////////////////////////////////////////
+/// \brief Seeded inputs in the puzzle formats, of
+/// any size
+///
+/////////////////////////////////////////////////
+namespace generator
+{
+/////////////////////////////////////////////////
+/// \brief Stream buffer producing seeded masses
+/// on demand, one per line, so that datasets of
+/// any size can be streamed without being stored
+///
+/////////////////////////////////////////////////
+class MassBuffer : public std::streambuf
+{
+public:
+    /////////////////////////////////////////////////
+    MassBuffer(uint64_t seed, uint64_t count) :
+    m_random(seed),
+    m_remaining(count)
+    {
+    }
+
+protected:
+    /////////////////////////////////////////////////
+    int_type underflow() override
+    {
+        if(gptr() < egptr())
+        {
+            return traits_type::to_int_type(*gptr());
+        }
+
+        size_t size = 0;
+        while(m_remaining > 0 && size + 24 < m_buffer.size())
+        {
+            auto [end, error] = std::to_chars(m_buffer.data() + size, m_buffer.data() + m_buffer.size(), mass(m_random));
+            size = end - m_buffer.data();
+            m_buffer[size++] = '\n';
+            --m_remaining;
+        }
+
+        if(size == 0)
+        {
+            return traits_type::eof();
+        }
+
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + size);
+
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    /////////////////////////////////////////////////
+    std::mt19937_64 m_random;
+    std::uniform_int_distribution<int64_t> mass{1, 1000000000};
+    uint64_t m_remaining;
+    std::array<char, 1 << 16> m_buffer;
+};
+
+/////////////////////////////////////////////////
+std::vector<int64_t> masses(uint64_t seed, size_t count);
+
+/////////////////////////////////////////////////
+/// \brief Generates a wire of random segments
+/// in the puzzle format, such as "R75"
+///
+/////////////////////////////////////////////////
+std::vector<std::string> wire(uint64_t seed, size_t segment_count, int64_t max_length = 100);
+
+/////////////////////////////////////////////////
+/// \brief Generates an orbit map where every body
+/// orbits one of the `width` previous bodies, so
+/// that a width of 1 gives a single deep chain
+///
+/// Bodies are named in base 36 on three characters
+/// as the puzzle does, growing longer once those
+/// run out. The last two bodies are YOU and SAN.
+///
+/////////////////////////////////////////////////
+std::vector<std::string> orbits(uint64_t seed, size_t body_count, size_t width);
+
+/////////////////////////////////////////////////
+/// \brief Struct representing a generated Intcode
+/// program with its input and expected diagnostic
+/// code
+///
+/////////////////////////////////////////////////
+struct Program
+{
+    /////////////////////////////////////////////////
+    std::vector<int64_t> integers;
+    int64_t loop_count = 1;
+    int64_t diagnostic_code = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Generates an Intcode program reading a
+/// loop count and running a random body of
+/// additions, multiplications, comparisons and
+/// jumps that many times before outputting its
+/// accumulator
+///
+/////////////////////////////////////////////////
+Program intcode_loop(uint64_t seed, size_t body_size, int64_t loop_count);
+
+/////////////////////////////////////////////////
+Vector2<int64_t> password_range(uint64_t seed);
+
+} // namespace generator
+
+#endif // ADVENT_OF_CODE_GENERATOR_HPP
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "heap.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+/////////////////////////////////////////////////
+namespace heap
+{
+/////////////////////////////////////////////////
+std::atomic<size_t> allocation_count = 0;
+
+/////////////////////////////////////////////////
+void* allocate(size_t bytes, size_t alignment)
+{
+    ++allocation_count;
+
+    void* address = nullptr;
+
+    if(alignment <= alignof(std::max_align_t))
+    {
+        address = std::malloc(std::max<size_t>(bytes, 1));
+    }
+    else
+    {
+        address = std::aligned_alloc(alignment, (std::max<size_t>(bytes, 1) + alignment - 1) / alignment * alignment);
+    }
+
+    if(!address)
+    {
+        throw std::bad_alloc();
+    }
+
+    return address;
+}
+
+} // namespace heap
+
+/////////////////////////////////////////////////
+void* operator new(size_t bytes)
+{
+    return heap::allocate(bytes, alignof(std::max_align_t));
+}
+
+/////////////////////////////////////////////////
+void* operator new(size_t bytes, std::align_val_t alignment)
+{
+    return heap::allocate(bytes, size_t(alignment));
+}
+
+/////////////////////////////////////////////////
+void operator delete(void* address) noexcept
+{
+    std::free(address);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void* address, size_t) noexcept
+{
+    std::free(address);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void* address, std::align_val_t) noexcept
+{
+    std::free(address);
+}
+
+/////////////////////////////////////////////////
+void operator delete(void* address, size_t, std::align_val_t) noexcept
+{
+    std::free(address);
+}
@@ -0,0 +1,24 @@
+#ifndef ADVENT_OF_CODE_HEAP_HPP
+#define ADVENT_OF_CODE_HEAP_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include <atomic>
+#include <cstddef>
+
+/////////////////////////////////////////////////
+namespace heap
+{
+/////////////////////////////////////////////////
+/// \brief Number of allocations made through the
+/// global operator new, which heap.cpp replaces in
+/// the executable linking it so that allocations
+/// bypassing a memory resource can be detected
+///
+/////////////////////////////////////////////////
+extern std::atomic<size_t> allocation_count;
+
+} // namespace heap
+
+#endif // ADVENT_OF_CODE_HEAP_HPP
@@ -0,0 +1,314 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "intcode.hpp"
+
+/////////////////////////////////////////////////
+namespace intcode
+{
+/////////////////////////////////////////////////
+void program_translater(std::pmr::vector<int64_t>& inputs, Sentence instructions)
+{
+    int64_t read_position = 0;
+    int64_t diagnostic_code = 0;
+
+    bool done = false;
+    while(!done)
+    {
+        int64_t instruction = inputs[read_position];
+
+        int64_t opcode = instruction % 100;
+
+        struct Modes
+        {
+            int64_t first = 0;
+            int64_t second = 0;
+            int64_t third = 0;
+        } modes;
+
+        modes.first = instruction / 100 % 10;
+        modes.second = instruction / 1000 % 10;
+        modes.third = instruction / 10000 % 10;
+
+        int64_t incrementer = 0;
+
+        switch(opcode)
+        {
+        case 1:
+        {
+            Vector2<int64_t> values;
+
+            if(modes.first == 0)
+            {
+                values.x = inputs[inputs[read_position + 1]];
+            }
+            else
+            {
+                values.x = inputs[read_position + 1];
+            }
+
+            if(modes.second == 0)
+            {
+                values.y = inputs[inputs[read_position + 2]];
+            }
+            else
+            {
+                values.y = inputs[read_position + 2];
+            }
+
+            inputs[inputs[read_position + 3]] = values.x + values.y;
+            incrementer = 4;
+            break;
+        }
+
+        case 2:
+        {
+            Vector2<int64_t> values;
+
+            if(modes.first == 0)
+            {
+                values.x = inputs[inputs[read_position + 1]];
+            }
+            else
+            {
+                values.x = inputs[read_position + 1];
+            }
+
+            if(modes.second == 0)
+            {
+                values.y = inputs[inputs[read_position + 2]];
+            }
+            else
+            {
+                values.y = inputs[read_position + 2];
+            }
+
+            inputs[inputs[read_position + 3]] = values.x * values.y;
+            incrementer = 4;
+            break;
+        }
+
+        case 3:
+        {
+            inputs[inputs[read_position + 1]] = instructions.noun;
+
+            incrementer = 2;
+
+            break;
+        }
+
+        case 4:
+        {
+            int64_t read_address = 0;
+
+            if(modes.first == 0)
+            {
+                read_address = inputs[read_position + 1];
+            }
+            else
+            {
+                read_address = read_position + 1;
+            }
+
+            diagnostic_code = inputs[read_address];
+
+            incrementer = 2;
+            break;
+        }
+
+        case 5:
+        {
+            Vector2<int64_t> values;
+
+            if(modes.first == 0)
+            {
+                values.x = inputs[inputs[read_position + 1]];
+            }
+            else
+            {
+                values.x = inputs[read_position + 1];
+            }
+
+            if(values.x != 0)
+            {
+                if(modes.second == 0)
+                {
+                    values.y = inputs[inputs[read_position + 2]];
+                }
+                else
+                {
+                    values.y = inputs[read_position + 2];
+                }
+
+                read_position = values.y;
+            }
+            else
+            {
+                incrementer = 3;
+            }
+
+            break;
+        }
+
+        case 6:
+        {
+
+            Vector2<int64_t> values;
+
+            if(modes.first == 0)
+            {
+                values.x = inputs[inputs[read_position + 1]];
+            }
+            else
+            {
+                values.x = inputs[read_position + 1];
+            }
+
+            if(values.x == 0)
+            {
+                if(modes.second == 0)
+                {
+                    values.y = inputs[inputs[read_position + 2]];
+                }
+                else
+                {
+                    values.y = inputs[read_position + 2];
+                }
+
+                read_position = values.y;
+            }
+            else
+            {
+                incrementer = 3;
+            }
+
+            break;
+        }
+
+        case 7:
+        {
+            Vector2<int64_t> values;
+
+            if(modes.first == 0)
+            {
+                values.x = inputs[inputs[read_position + 1]];
+            }
+            else
+            {
+                values.x = inputs[read_position + 1];
+            }
+
+            if(modes.second == 0)
+            {
+                values.y = inputs[inputs[read_position + 2]];
+            }
+            else
+            {
+                values.y = inputs[read_position + 2];
+            }
+
+            if(values.x < values.y)
+            {
+                inputs[inputs[read_position + 3]] = 1;
+            }
+            else
+            {
+                inputs[inputs[read_position + 3]] = 0;
+            }
+
+            incrementer = 4;
+            break;
+        }
+
+        case 8:
+        {
+            Vector2<int64_t> values;
+
+            if(modes.first == 0)
+            {
+                values.x = inputs[inputs[read_position + 1]];
+            }
+            else
+            {
+                values.x = inputs[read_position + 1];
+            }
+
+            if(modes.second == 0)
+            {
+                values.y = inputs[inputs[read_position + 2]];
+            }
+            else
+            {
+                values.y = inputs[read_position + 2];
+            }
+
+            if(values.x == values.y)
+            {
+                inputs[inputs[read_position + 3]] = 1;
+            }
+            else
+            {
+                inputs[inputs[read_position + 3]] = 0;
+            }
+
+            incrementer = 4;
+            break;
+        }
+
+        default:
+            done = true;
+            break;
+        }
+
+        read_position += incrementer;
+    }
+
+    inputs.push_back(diagnostic_code);
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> program_caller(const std::vector<int64_t>& inputs, Sentence instructions, std::pmr::vector<int64_t>& memory)
+{
+    memory.reserve(inputs.size() + 1);
+    memory.assign(inputs.begin(), inputs.end());
+
+    //Initialization
+    if(memory[0] != 3)
+    {
+        memory[1] = instructions.noun;
+        memory[2] = instructions.verb;
+    }
+
+    program_translater(memory, instructions);
+
+    return {memory.front(), memory.back()};
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> program_caller(const std::vector<int64_t>& inputs, Sentence instructions, std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<int64_t> memory(resource);
+    return program_caller(inputs, instructions, memory);
+}
+
+/////////////////////////////////////////////////
+int64_t instruction_solver(const std::vector<int64_t>& inputs, int64_t code, std::pmr::memory_resource* resource)
+{
+    Sentence instructions;
+    std::pmr::vector<int64_t> memory(resource);
+
+    for(instructions.noun = 0; instructions.noun <= 99; ++instructions.noun)
+    {
+        for(instructions.verb = 0; instructions.verb <= 99; ++instructions.verb)
+        {
+            if(program_caller(inputs, instructions, memory).x == code)
+            {
+                return 100 * instructions.noun + instructions.verb;
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace intcode
@@ -0,0 +1,33 @@
+#ifndef ADVENT_OF_CODE_INTCODE_HPP
+#define ADVENT_OF_CODE_INTCODE_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "common.hpp"
+
+/////////////////////////////////////////////////
+/// \brief Intcode interpreter (days 2 and 5)
+///
+/////////////////////////////////////////////////
+namespace intcode
+{
+/////////////////////////////////////////////////
+void program_translater(std::pmr::vector<int64_t>& inputs, Sentence instructions = {});
+
+/////////////////////////////////////////////////
+/// \brief Runs a program in a memory buffer that
+/// can be reused from one call to another
+///
+/////////////////////////////////////////////////
+Vector2<int64_t> program_caller(const std::vector<int64_t>& inputs, Sentence instructions, std::pmr::vector<int64_t>& memory);
+
+/////////////////////////////////////////////////
+Vector2<int64_t> program_caller(const std::vector<int64_t>& inputs, Sentence instructions, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+int64_t instruction_solver(const std::vector<int64_t>& inputs, int64_t code, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+} // namespace intcode
+
+#endif // ADVENT_OF_CODE_INTCODE_HPP
@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "orbit.hpp"
+
+/////////////////////////////////////////////////
+namespace orbit
+{
+/////////////////////////////////////////////////
+Parents parents(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource)
+{
+    Parents orbit_parents(resource);
+
+    for(const auto& input: inputs)
+    {
+        std::string_view relation = input;
+        size_t separator = relation.find(')');
+
+        if(separator != std::string_view::npos)
+        {
+            orbit_parents[relation.substr(separator + 1)] = relation.substr(0, separator);
+        }
+    }
+
+    return orbit_parents;
+}
+
+/////////////////////////////////////////////////
+int64_t total_count(const Parents& orbit_parents, std::pmr::memory_resource* resource)
+{
+    std::pmr::map<std::string_view, int64_t> depths(resource);
+    std::pmr::vector<std::string_view> unknown_depths(resource);
+
+    int64_t count = 0;
+
+    for(auto& [object, parent]: orbit_parents)
+    {
+        std::string_view ancestor = object;
+        int64_t depth = 0;
+
+        while(true)
+        {
+            auto known_depth = depths.find(ancestor);
+
+            if(known_depth != depths.end())
+            {
+                depth = known_depth->second;
+                break;
+            }
+
+            auto ancestor_parent = orbit_parents.find(ancestor);
+
+            if(ancestor_parent == orbit_parents.end())
+            {
+                break;
+            }
+
+            unknown_depths.push_back(ancestor);
+            ancestor = ancestor_parent->second;
+        }
+
+        while(!unknown_depths.empty())
+        {
+            depths.emplace(unknown_depths.back(), ++depth);
+            unknown_depths.pop_back();
+        }
+
+        count += depths.find(object)->second;
+    }
+
+    return count;
+}
+
+/////////////////////////////////////////////////
+int64_t total_count(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource)
+{
+    return total_count(parents(inputs, resource), resource);
+}
+
+/////////////////////////////////////////////////
+int64_t transfer_count(const Parents& orbit_parents, std::string_view from, std::string_view to, std::pmr::memory_resource* resource)
+{
+    std::pmr::map<std::string_view, int64_t> from_distances(resource);
+
+    int64_t distance = 0;
+    for(auto parent = orbit_parents.find(from); parent != orbit_parents.end(); parent = orbit_parents.find(parent->second))
+    {
+        from_distances.emplace(parent->second, distance++);
+    }
+
+    distance = 0;
+    for(auto parent = orbit_parents.find(to); parent != orbit_parents.end(); parent = orbit_parents.find(parent->second))
+    {
+        auto common_object = from_distances.find(parent->second);
+
+        if(common_object != from_distances.end())
+        {
+            return common_object->second + distance;
+        }
+
+        ++distance;
+    }
+
+    return -1;
+}
+
+/////////////////////////////////////////////////
+int64_t transfer_count(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource)
+{
+    return std::max<int64_t>(transfer_count(parents(inputs, resource), "YOU", "SAN", resource), 0);
+}
+
+} // namespace orbit
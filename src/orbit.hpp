@@ -0,0 +1,55 @@
+#ifndef ADVENT_OF_CODE_ORBIT_HPP
+#define ADVENT_OF_CODE_ORBIT_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "common.hpp"
+
+/////////////////////////////////////////////////
+/// \brief Orbit counts and transfers of an orbit
+/// map (day 6)
+///
+/////////////////////////////////////////////////
+namespace orbit
+{
+/////////////////////////////////////////////////
+using Parents = std::pmr::map<std::string_view, std::string_view>;
+
+/////////////////////////////////////////////////
+/// \brief Maps every object to the object it
+/// orbits, viewing the names inside the inputs
+///
+/// Relations are split on ')' so that names are
+/// not bound to three characters.
+///
+/////////////////////////////////////////////////
+Parents parents(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+/// \brief Counts the direct and indirect orbits of
+/// every object, memoizing the depth of each
+/// ancestor so that every object is walked once
+///
+/////////////////////////////////////////////////
+int64_t total_count(const Parents& orbit_parents, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+int64_t total_count(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+/// \brief Counts the transfers needed to move
+/// from the object `from` orbits to the object
+/// `to` orbits
+///
+/// \return -1 if the objects share no ancestor
+///
+/////////////////////////////////////////////////
+int64_t transfer_count(const Parents& orbit_parents, std::string_view from, std::string_view to, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+int64_t transfer_count(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+} // namespace orbit
+
+#endif // ADVENT_OF_CODE_ORBIT_HPP
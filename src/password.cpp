@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "password.hpp"
+
+/////////////////////////////////////////////////
+namespace password
+{
+/////////////////////////////////////////////////
+int64_t criteria_count(Vector2<int64_t> range)
+{
+    int64_t minimal_number = range.x;
+    int64_t current_number = minimal_number;
+
+    int64_t count = 0;
+
+    while(current_number <= range.y)
+    {
+        bool same_digits = false;
+
+        auto digits = std::to_string(current_number);
+        for(size_t character = 0; character < digits.size() - 1; ++character)
+        {
+            if(digits[character] - '0' > digits[character + 1] - '0')
+            {
+                std::fill(digits.begin() + character + 1, digits.end(), digits[character]);
+            }
+
+            if(digits[character] == digits[character + 1])
+            {
+                same_digits = true;
+            }
+        }
+
+        current_number = std::stoi(digits);
+
+        if(current_number <= range.y && same_digits)
+        {
+            count++;
+        }
+
+        current_number++;
+    }
+
+    return count;
+}
+
+/////////////////////////////////////////////////
+int64_t group_criteria_count(Vector2<int64_t> range)
+{
+    int64_t minimal_number = range.x;
+    int64_t current_number = minimal_number;
+
+    int64_t count = 0;
+
+    while(current_number <= range.y)
+    {
+        bool same_digits = false;
+
+        auto digits = std::to_string(current_number);
+        for(size_t character = 0; character < digits.size() - 1; ++character)
+        {
+            if(digits[character] - '0' > digits[character + 1] - '0')
+            {
+                std::fill(digits.begin() + character + 1, digits.end(), digits[character]);
+            }
+        }
+
+        for(size_t character = 0; character < digits.size() - 1; ++character)
+        {
+            if(digits[character] == digits[character + 1])
+            {
+                same_digits = true;
+
+                if(character > 0 && digits[character - 1] == digits[character])
+                {
+                    same_digits = false;
+                }
+
+                if(character < digits.size() - 1 && digits[character + 2] == digits[character])
+                {
+                    same_digits = false;
+                }
+
+                if(same_digits)
+                {
+                    break;
+                }
+            }
+        }
+
+        current_number = std::stoi(digits);
+
+        if(current_number <= range.y && same_digits)
+        {
+            count++;
+        }
+
+        current_number++;
+    }
+
+    return count;
+}
+
+} // namespace password
@@ -0,0 +1,24 @@
+#ifndef ADVENT_OF_CODE_PASSWORD_HPP
+#define ADVENT_OF_CODE_PASSWORD_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "common.hpp"
+
+/////////////////////////////////////////////////
+/// \brief Passwords meeting the criteria within a
+/// range (day 4)
+///
+/////////////////////////////////////////////////
+namespace password
+{
+/////////////////////////////////////////////////
+int64_t criteria_count(Vector2<int64_t> range);
+
+/////////////////////////////////////////////////
+int64_t group_criteria_count(Vector2<int64_t> range);
+
+} // namespace password
+
+#endif // ADVENT_OF_CODE_PASSWORD_HPP
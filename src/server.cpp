@@ -0,0 +1,615 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "server.hpp"
+#include "fuel.hpp"
+#include "intcode.hpp"
+#include "wire_line.hpp"
+#include "password.hpp"
+#include "orbit.hpp"
+#include <csignal>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+/////////////////////////////////////////////////
+namespace server
+{
+/////////////////////////////////////////////////
+/// \brief Struct representing a query waiting for
+/// its reply
+///
+/////////////////////////////////////////////////
+struct Request
+{
+    /////////////////////////////////////////////////
+    std::vector<std::string> arguments;
+    std::promise<std::string> reply;
+};
+
+/////////////////////////////////////////////////
+/// \brief Thread answering the queries of a
+/// subsystem by batches of every query pending
+/// since the previous batch
+///
+/////////////////////////////////////////////////
+class Batcher
+{
+public:
+    /////////////////////////////////////////////////
+    using Handler = std::function<void(std::vector<Request>&)>;
+
+    /////////////////////////////////////////////////
+    explicit Batcher(Handler handler) :
+    m_handler(std::move(handler)),
+    m_worker([this]()
+    {
+        std::vector<Request> batch;
+
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]()
+                {
+                    return m_stopping || !m_pending.empty();
+                });
+
+                if(m_pending.empty())
+                {
+                    return;
+                }
+
+                std::swap(batch, m_pending);
+            }
+
+            try
+            {
+                m_handler(batch);
+            }
+            catch(const std::exception& exception)
+            {
+                reply_error(batch, exception.what());
+            }
+            catch(...)
+            {
+                reply_error(batch, "unknown failure");
+            }
+
+            batch.clear();
+        }
+    })
+    {
+    }
+
+    /////////////////////////////////////////////////
+    ~Batcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+
+        m_condition.notify_one();
+        m_worker.join();
+    }
+
+    /////////////////////////////////////////////////
+    Batcher(const Batcher&) = delete;
+    Batcher& operator=(const Batcher&) = delete;
+
+    /////////////////////////////////////////////////
+    std::future<std::string> submit(std::vector<std::string> arguments)
+    {
+        std::future<std::string> reply;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.push_back({std::move(arguments), {}});
+            reply = m_pending.back().reply.get_future();
+        }
+
+        m_condition.notify_one();
+
+        return reply;
+    }
+
+private:
+    /////////////////////////////////////////////////
+    /// \brief Replies an error to the requests of a
+    /// failed batch that were not answered yet
+    ///
+    /////////////////////////////////////////////////
+    static void reply_error(std::vector<Request>& batch, const std::string& message)
+    {
+        for(auto& request: batch)
+        {
+            try
+            {
+                request.reply.set_value("error " + message);
+            }
+            catch(const std::future_error&)
+            {
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////
+    Handler m_handler;
+    std::vector<Request> m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping = false;
+    std::thread m_worker;
+};
+
+/////////////////////////////////////////////////
+template <typename Type>
+bool parse_argument(const std::string& argument, Type& value)
+{
+    auto [end, error] = std::from_chars(argument.data(), argument.data() + argument.size(), value);
+    return error == std::errc() && end == argument.data() + argument.size();
+}
+
+/////////////////////////////////////////////////
+/// \brief Puzzle inputs parsed once and the
+/// indices built on them, shared by every query
+///
+/////////////////////////////////////////////////
+struct State
+{
+    /////////////////////////////////////////////////
+    std::map<std::string, std::vector<int64_t>, std::less<>> programs = {{"gravity", get_input_list<int64_t>("inputs/02-program_integers.txt")}, {"diagnostic", get_input_list<int64_t>("inputs/05-program_integers.txt")}};
+    std::vector<int64_t> masses = get_input_list<int64_t>("inputs/01-mass_input.txt");
+    std::array<std::vector<std::string>, 2> wires = wire_line::input_list("inputs/03-wire-maps.txt");
+    Vector2<int64_t> wire_distances = {wire_line::closest_intersection(wires).standard(), wire_line::fewest_combined_steps(wires).standard()};
+    std::vector<std::string> orbits = get_input_list<std::string>("inputs/06-orbit-map.txt");
+    orbit::Parents orbit_parents = orbit::parents(orbits);
+};
+
+/////////////////////////////////////////////////
+/// \brief Parses a wire given in a query, whose
+/// segments are bounded so that a single query
+/// cannot exhaust the memory of the server
+///
+/// \return False if the wire is malformed or out
+/// of bounds
+///
+/////////////////////////////////////////////////
+bool parse_wire(std::string_view argument, std::vector<std::string>& wire)
+{
+    constexpr size_t max_segment_count = 10000;
+    constexpr int64_t max_segment_length = 100000;
+    constexpr int64_t max_step_count = 1000000;
+
+    int64_t step_count = 0;
+
+    for(auto token: Tokens(argument, ","))
+    {
+        int64_t length = 0;
+
+        if(wire.size() >= max_segment_count || token.size() < 2 || std::string_view("LURD").find(token.front()) == std::string_view::npos || !parse_argument(std::string(token.substr(1)), length))
+        {
+            return false;
+        }
+
+        step_count += length;
+
+        if(length < 1 || length > max_segment_length || step_count > max_step_count)
+        {
+            return false;
+        }
+
+        wire.emplace_back(token);
+    }
+
+    return !wire.empty();
+}
+
+/////////////////////////////////////////////////
+/// \brief Answers the queries of one line each,
+/// a subsystem name followed by its arguments:
+///
+/// - intcode <gravity or diagnostic> <noun> <verb>
+/// - password <minimum> <maximum>, at most
+///   999999999 and 10000000 apart
+/// - orbit <object> <object>
+/// - wire [<first wire> <second wire>], of at
+///   most 10000 segments and 1000000 steps each
+/// - fuel [<mass>...], of at most 100000 masses
+///
+/// Lines longer than 1 MiB are answered an error
+/// and dropped without being buffered.
+///
+/////////////////////////////////////////////////
+class Server
+{
+public:
+    /////////////////////////////////////////////////
+    static constexpr size_t max_line_length = size_t(1) << 20;
+    static constexpr size_t max_mass_count = 100000;
+
+    /////////////////////////////////////////////////
+    Server() :
+    m_intcode([this](std::vector<Request>& batch)
+    {
+        std::pmr::vector<int64_t> memory(&m_intcode_arena);
+
+        for(auto& request: batch)
+        {
+            Sentence instructions;
+
+            if(request.arguments.size() != 4 || !parse_argument(request.arguments[2], instructions.noun) || !parse_argument(request.arguments[3], instructions.verb))
+            {
+                request.reply.set_value("error usage: intcode <gravity or diagnostic> <noun> <verb>");
+                continue;
+            }
+
+            auto program = m_state.programs.find(request.arguments[1]);
+
+            if(program == m_state.programs.end())
+            {
+                request.reply.set_value("error unknown program");
+                continue;
+            }
+
+            // The programs are trusted but not their inputs, which must keep them in their memory
+            bool valid = program->first == "gravity" ? (instructions.noun >= 0 && instructions.noun <= 99 && instructions.verb >= 0 && instructions.verb <= 99) : (instructions.noun == 1 || instructions.noun == 5);
+
+            if(!valid)
+            {
+                request.reply.set_value("error input out of the program range");
+                continue;
+            }
+
+            auto result = intcode::program_caller(program->second, instructions, memory);
+            request.reply.set_value(std::to_string(result.x) + ' ' + std::to_string(result.y));
+        }
+    }),
+    m_password([](std::vector<Request>& batch)
+    {
+        for(auto& request: batch)
+        {
+            Vector2<int64_t> range;
+
+            if(request.arguments.size() != 3 || !parse_argument(request.arguments[1], range.x) || !parse_argument(request.arguments[2], range.y))
+            {
+                request.reply.set_value("error usage: password <minimum> <maximum>");
+                continue;
+            }
+
+            if(range.x < 0 || range.x > range.y || range.y > 999999999 || range.y - range.x > 10000000)
+            {
+                request.reply.set_value("error range out of bounds");
+                continue;
+            }
+
+            request.reply.set_value(std::to_string(password::criteria_count(range)) + ' ' + std::to_string(password::group_criteria_count(range)));
+        }
+    }),
+    m_orbit([this](std::vector<Request>& batch)
+    {
+        std::pmr::monotonic_buffer_resource arena;
+
+        for(auto& request: batch)
+        {
+            if(request.arguments.size() != 3)
+            {
+                request.reply.set_value("error usage: orbit <object> <object>");
+                continue;
+            }
+
+            auto transfer_count = orbit::transfer_count(m_state.orbit_parents, request.arguments[1], request.arguments[2], &arena);
+            arena.release();
+
+            if(transfer_count < 0)
+            {
+                request.reply.set_value("error unknown object or no common ancestor");
+                continue;
+            }
+
+            request.reply.set_value(std::to_string(transfer_count));
+        }
+    }),
+    m_wire([this](std::vector<Request>& batch)
+    {
+        std::pmr::monotonic_buffer_resource arena;
+
+        for(auto& request: batch)
+        {
+            if(request.arguments.size() == 1)
+            {
+                request.reply.set_value(std::to_string(m_state.wire_distances.x) + ' ' + std::to_string(m_state.wire_distances.y));
+                continue;
+            }
+
+            std::array<std::vector<std::string>, 2> wires;
+
+            if(request.arguments.size() != 3 || !parse_wire(request.arguments[1], wires[0]) || !parse_wire(request.arguments[2], wires[1]))
+            {
+                request.reply.set_value("error usage: wire [<first wire> <second wire>]");
+                continue;
+            }
+
+            request.reply.set_value(std::to_string(wire_line::closest_intersection(wires, &arena).standard()) + ' ' + std::to_string(wire_line::fewest_combined_steps(wires, &arena).standard()));
+            arena.release();
+        }
+    }),
+    m_fuel([this](std::vector<Request>& batch)
+    {
+        std::vector<int64_t> masses;
+
+        for(auto& request: batch)
+        {
+            if(request.arguments.size() - 1 > max_mass_count)
+            {
+                request.reply.set_value("error too many masses");
+                continue;
+            }
+
+            masses.resize(request.arguments.size() - 1);
+
+            bool valid = true;
+            for(size_t mass = 0; mass < masses.size(); ++mass)
+            {
+                valid = valid && parse_argument(request.arguments[mass + 1], masses[mass]);
+            }
+
+            if(!valid)
+            {
+                request.reply.set_value("error usage: fuel [<mass>...]");
+                continue;
+            }
+
+            const auto& inputs = masses.empty() ? m_state.masses : masses;
+            request.reply.set_value(std::to_string(fuel::requirement(inputs)) + ' ' + std::to_string(fuel::total_requirement(inputs)));
+        }
+    })
+    {
+    }
+
+    /////////////////////////////////////////////////
+    /// \brief Queues a query line to the batcher of
+    /// its subsystem
+    ///
+    /////////////////////////////////////////////////
+    std::future<std::string> query(std::string_view line)
+    {
+        std::vector<std::string> arguments;
+        for(auto token: Tokens(line))
+        {
+            arguments.emplace_back(token);
+        }
+
+        std::map<std::string_view, Batcher*> batchers = {{"intcode", &m_intcode}, {"password", &m_password}, {"orbit", &m_orbit}, {"wire", &m_wire}, {"fuel", &m_fuel}};
+
+        auto batcher = arguments.empty() ? batchers.end() : batchers.find(arguments.front());
+
+        if(batcher == batchers.end())
+        {
+            std::promise<std::string> reply;
+            reply.set_value("error unknown query");
+            return reply.get_future();
+        }
+
+        return batcher->second->submit(std::move(arguments));
+    }
+
+    /////////////////////////////////////////////////
+    /// \brief Listens on a Unix domain socket and
+    /// answers every connection on its own thread
+    ///
+    /// \return Exit code of the server
+    ///
+    /////////////////////////////////////////////////
+    int run(const std::filesystem::path& socket_path)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+
+        if(socket_path.native().size() >= sizeof(address.sun_path))
+        {
+            std::cerr << "Socket path too long: " << socket_path << std::endl;
+            return 1;
+        }
+
+        std::copy(socket_path.native().begin(), socket_path.native().end(), address.sun_path);
+
+        // Only a socket left by a previous run may be replaced, never another file
+        struct stat status;
+        if(::lstat(socket_path.c_str(), &status) == 0)
+        {
+            if(!S_ISSOCK(status.st_mode))
+            {
+                std::cerr << "Cannot replace " << socket_path << ", which is not a socket" << std::endl;
+                return 1;
+            }
+
+            if(::unlink(socket_path.c_str()) < 0)
+            {
+                std::cerr << "Cannot remove the previous socket " << socket_path << std::endl;
+                return 1;
+            }
+        }
+
+        // A client closing early must only end its own connection
+        std::signal(SIGPIPE, SIG_IGN);
+
+        int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if(listener < 0 || ::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || ::listen(listener, SOMAXCONN) < 0)
+        {
+            std::cerr << "Cannot listen on " << socket_path << std::endl;
+            return 1;
+        }
+
+        std::cout << "Listening on " << socket_path << std::endl;
+
+        while(true)
+        {
+            int connection = ::accept(listener, nullptr, nullptr);
+
+            if(connection < 0)
+            {
+                // Running out of descriptors or memory passes once connections close, anything else will not
+                if(errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    continue;
+                }
+
+                if(errno == EINTR || errno == ECONNABORTED || errno == EPROTO)
+                {
+                    continue;
+                }
+
+                std::cerr << "Cannot accept connections on " << socket_path << ": " << std::strerror(errno) << std::endl;
+                return 1;
+            }
+
+            std::thread([this, connection]()
+            {
+                serve(connection);
+                ::close(connection);
+            }).detach();
+        }
+#else
+        std::cerr << "Unix domain sockets are not available on this platform" << std::endl;
+        return 1;
+#endif
+    }
+
+private:
+    /////////////////////////////////////////////////
+    /// \brief Answers the lines of a connection in
+    /// order, queueing every complete line received
+    /// before waiting for their replies
+    ///
+    /////////////////////////////////////////////////
+    void serve(int connection)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+#ifdef MSG_NOSIGNAL
+        constexpr int send_flags = MSG_NOSIGNAL;
+#else
+        constexpr int send_flags = 0;
+#endif
+
+        auto send_all = [connection](const std::string& response)
+        {
+            for(size_t written = 0; written < response.size();)
+            {
+                auto sent = ::send(connection, response.data() + written, response.size() - written, send_flags);
+
+                if(sent <= 0)
+                {
+                    return false;
+                }
+
+                written += sent;
+            }
+
+            return true;
+        };
+
+        std::string received;
+        std::array<char, 4096> buffer;
+        bool dropping = false;
+
+        while(true)
+        {
+            auto size = ::read(connection, buffer.data(), buffer.size());
+
+            if(size <= 0)
+            {
+                return;
+            }
+
+            received.append(buffer.data(), size);
+
+            // The rest of a line too long is dropped up to its end
+            if(dropping)
+            {
+                size_t dropped_end = received.find('\n');
+                received.erase(0, dropped_end == std::string::npos ? received.size() : dropped_end + 1);
+                dropping = dropped_end == std::string::npos;
+            }
+
+            size_t line_end = received.rfind('\n');
+            if(line_end == std::string::npos)
+            {
+                if(received.size() > max_line_length)
+                {
+                    received.clear();
+                    dropping = true;
+
+                    if(!send_all("error line too long\n"))
+                    {
+                        return;
+                    }
+                }
+
+                continue;
+            }
+
+            bool quitting = false;
+
+            std::vector<std::future<std::string>> replies;
+            for(auto line: Tokens(std::string_view(received).substr(0, line_end), Tokens::lines))
+            {
+                if(line == "quit")
+                {
+                    quitting = true;
+                    break;
+                }
+
+                if(line.size() > max_line_length)
+                {
+                    std::promise<std::string> reply;
+                    reply.set_value("error line too long");
+                    replies.push_back(reply.get_future());
+                    continue;
+                }
+
+                replies.push_back(query(line));
+            }
+
+            received.erase(0, line_end + 1);
+
+            std::string response;
+            for(auto& reply: replies)
+            {
+                response += reply.get() + '\n';
+            }
+
+            if(!send_all(response) || quitting)
+            {
+                return;
+            }
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////
+    State m_state;
+    std::pmr::unsynchronized_pool_resource m_intcode_arena;
+    Batcher m_intcode;
+    Batcher m_password;
+    Batcher m_orbit;
+    Batcher m_wire;
+    Batcher m_fuel;
+};
+
+/////////////////////////////////////////////////
+int run(const std::filesystem::path& socket_path)
+{
+    Server server;
+    return server.run(socket_path);
+}
+
+} // namespace server
@@ -0,0 +1,24 @@
+#ifndef ADVENT_OF_CODE_SERVER_HPP
+#define ADVENT_OF_CODE_SERVER_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include <filesystem>
+
+/////////////////////////////////////////////////
+namespace server
+{
+/////////////////////////////////////////////////
+/// \brief Keeps the puzzle inputs in memory and
+/// answers the queries received one per line on a
+/// Unix domain socket
+///
+/// \return Exit code of the server
+///
+/////////////////////////////////////////////////
+int run(const std::filesystem::path& socket_path);
+
+} // namespace server
+
+#endif // ADVENT_OF_CODE_SERVER_HPP
@@ -0,0 +1,684 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "verification.hpp"
+#include "fuel.hpp"
+#include "intcode.hpp"
+#include "wire_line.hpp"
+#include "password.hpp"
+#include "orbit.hpp"
+#include "generator.hpp"
+#include "heap.hpp"
+#include <iomanip>
+#include <random>
+
+/////////////////////////////////////////////////
+namespace verification
+{
+/////////////////////////////////////////////////
+/// \brief Counts and prints the checks of a
+/// verification run
+///
+/////////////////////////////////////////////////
+struct Report
+{
+    /////////////////////////////////////////////////
+    int failures = 0;
+
+    /////////////////////////////////////////////////
+    void check(const std::string& name, bool passed, const std::string& detail = "")
+    {
+        std::cout << (passed ? "[PASS] " : "[FAIL] ") << name;
+
+        if(!detail.empty())
+        {
+            std::cout << " (" << detail << ')';
+        }
+
+        std::cout << std::endl;
+
+        if(!passed)
+        {
+            ++failures;
+        }
+    }
+};
+
+/////////////////////////////////////////////////
+/// \brief Straightforward implementations the
+/// optimized code paths are compared against
+///
+/////////////////////////////////////////////////
+namespace reference
+{
+/////////////////////////////////////////////////
+Vector2<int64_t> fuel_requirement(std::istream& reader)
+{
+    Vector2<int64_t> requirements = {0, 0};
+
+    int64_t mass = 0;
+    while(reader >> mass)
+    {
+        auto remaining_mass = fuel::calculator(mass);
+        requirements.x += remaining_mass;
+
+        while(remaining_mass > 0)
+        {
+            requirements.y += remaining_mass;
+            remaining_mass = fuel::calculator(remaining_mass);
+        }
+    }
+
+    return requirements;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> intcode_program(std::vector<int64_t> memory, Sentence instructions)
+{
+    if(memory.at(0) != 3)
+    {
+        memory.at(1) = instructions.noun;
+        memory.at(2) = instructions.verb;
+    }
+
+    int64_t diagnostic_code = 0;
+
+    for(size_t position = 0;;)
+    {
+        int64_t instruction = memory.at(position);
+
+        auto value = [&memory, instruction, position](size_t parameter)
+        {
+            int64_t mode = instruction / (parameter == 1 ? 100 : 1000) % 10;
+            int64_t operand = memory.at(position + parameter);
+
+            return mode ? operand : memory.at(operand);
+        };
+
+        auto target = [&memory, position](size_t parameter) -> int64_t&
+        {
+            return memory.at(memory.at(position + parameter));
+        };
+
+        switch(instruction % 100)
+        {
+        case 1:
+            target(3) = value(1) + value(2);
+            position += 4;
+            break;
+        case 2:
+            target(3) = value(1) * value(2);
+            position += 4;
+            break;
+        case 3:
+            target(1) = instructions.noun;
+            position += 2;
+            break;
+        case 4:
+            diagnostic_code = value(1);
+            position += 2;
+            break;
+        case 5:
+            position = value(1) != 0 ? value(2) : position + 3;
+            break;
+        case 6:
+            position = value(1) == 0 ? value(2) : position + 3;
+            break;
+        case 7:
+            target(3) = value(1) < value(2);
+            position += 4;
+            break;
+        case 8:
+            target(3) = value(1) == value(2);
+            position += 4;
+            break;
+        default:
+            return {memory.front(), diagnostic_code};
+        }
+    }
+}
+
+/////////////////////////////////////////////////
+bool password_criteria(int64_t number, bool strict_group)
+{
+    auto digits = std::to_string(number);
+
+    if(!std::is_sorted(digits.begin(), digits.end()))
+    {
+        return false;
+    }
+
+    for(size_t begin = 0; begin < digits.size();)
+    {
+        size_t end = digits.find_first_not_of(digits[begin], begin);
+        end = end == std::string::npos ? digits.size() : end;
+
+        if(strict_group ? end - begin == 2 : end - begin >= 2)
+        {
+            return true;
+        }
+
+        begin = end;
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> orbit_counts(const std::vector<std::string>& inputs)
+{
+    std::map<std::string, std::string> parents;
+
+    for(const auto& input: inputs)
+    {
+        size_t separator = input.find(')');
+        parents[input.substr(separator + 1)] = input.substr(0, separator);
+    }
+
+    auto ancestors = [&parents](std::string object)
+    {
+        std::vector<std::string> chain;
+
+        for(auto parent = parents.find(object); parent != parents.end(); parent = parents.find(parent->second))
+        {
+            chain.push_back(parent->second);
+        }
+
+        return chain;
+    };
+
+    Vector2<int64_t> counts = {0, 0};
+
+    for(const auto& [object, parent]: parents)
+    {
+        counts.x += ancestors(object).size();
+    }
+
+    auto you_chain = ancestors("YOU");
+    auto santa_chain = ancestors("SAN");
+
+    for(size_t you_position = 0; you_position < you_chain.size(); ++you_position)
+    {
+        auto santa_position = std::find(santa_chain.begin(), santa_chain.end(), you_chain[you_position]);
+
+        if(santa_position != santa_chain.end())
+        {
+            counts.y = you_position + std::distance(santa_chain.begin(), santa_position);
+            break;
+        }
+    }
+
+    return counts;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> wire_distances(const std::array<std::vector<std::string>, 2>& wires)
+{
+    std::map<std::pair<int64_t, int64_t>, int64_t> first_steps;
+
+    auto first_wire = wire_line::definer(wires[0]);
+    auto second_wire = wire_line::definer(wires[1]);
+
+    for(size_t step = 0; step < first_wire.size(); ++step)
+    {
+        first_steps.insert({{first_wire[step].x, first_wire[step].y}, int64_t(step + 1)});
+    }
+
+    Vector2<int64_t> distances = {0, int64_t(first_wire.size() + second_wire.size())};
+
+    for(size_t step = 0; step < second_wire.size(); ++step)
+    {
+        auto crossing = first_steps.find({second_wire[step].x, second_wire[step].y});
+
+        if(crossing != first_steps.end())
+        {
+            auto distance = second_wire[step].standard();
+
+            if(distances.x == 0 || distance < distances.x)
+            {
+                distances.x = distance;
+            }
+
+            distances.y = std::min<int64_t>(distances.y, crossing->second + step + 1);
+        }
+    }
+
+    return distances;
+}
+
+} // namespace reference
+
+/////////////////////////////////////////////////
+/// \brief Fits the exponent k of a time ~ n^k
+/// curve by least squares on logarithms
+///
+/// Only the function is timed, its input being
+/// prepared for every size beforehand.
+///
+/////////////////////////////////////////////////
+template<typename Prepare, typename Function>
+double fit_exponent(const std::vector<size_t>& sizes, Prepare prepare, Function function)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::vector<double> log_sizes;
+    std::vector<double> log_times;
+
+    for(auto size: sizes)
+    {
+        const auto input = prepare(size);
+        double best = std::numeric_limits<double>::max();
+
+        for(int run = 0; run < 3; ++run)
+        {
+            auto start = clock::now();
+            function(input);
+            best = std::min(best, std::chrono::duration<double>(clock::now() - start).count());
+        }
+
+        log_sizes.push_back(std::log(double(size)));
+        log_times.push_back(std::log(std::max(best, 1e-9)));
+    }
+
+    double mean_size = std::accumulate(log_sizes.begin(), log_sizes.end(), 0.0) / log_sizes.size();
+    double mean_time = std::accumulate(log_times.begin(), log_times.end(), 0.0) / log_times.size();
+
+    double covariance = 0;
+    double variance = 0;
+
+    for(size_t point = 0; point < log_sizes.size(); ++point)
+    {
+        covariance += (log_sizes[point] - mean_size) * (log_times[point] - mean_time);
+        variance += (log_sizes[point] - mean_size) * (log_sizes[point] - mean_size);
+    }
+
+    return covariance / variance;
+}
+
+/////////////////////////////////////////////////
+/// \brief Runs a function with the null memory
+/// resource as default, so that any allocation not
+/// made through the resource it was given throws,
+/// and fails if it reaches the global operator new
+///
+/// Spawning threads is exempt: the state of every
+/// std::thread comes from the global operator new,
+/// so that many allocations are allowed for each
+/// of the spawned threads.
+///
+/////////////////////////////////////////////////
+template <typename Function>
+bool allocates_from_given_resource(Function function, size_t spawned_thread_count = 0)
+{
+    static const size_t thread_allocation_count = []()
+    {
+        size_t previous_allocation_count = heap::allocation_count;
+        std::thread([]() {}).join();
+        return heap::allocation_count - previous_allocation_count;
+    }();
+
+    auto previous_resource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    size_t previous_allocation_count = heap::allocation_count;
+
+    bool passed = true;
+
+    try
+    {
+        function();
+    }
+    catch(const std::bad_alloc&)
+    {
+        passed = false;
+    }
+
+    passed = passed && heap::allocation_count - previous_allocation_count <= spawned_thread_count * thread_allocation_count;
+
+    std::pmr::set_default_resource(previous_resource);
+
+    return passed;
+}
+
+/////////////////////////////////////////////////
+std::vector<size_t> doubling_sizes(size_t first_size, size_t count)
+{
+    std::vector<size_t> sizes;
+
+    for(size_t size = first_size; sizes.size() < count; size *= 2)
+    {
+        sizes.push_back(size);
+    }
+
+    return sizes;
+}
+
+/////////////////////////////////////////////////
+int run(uint64_t scale, double tolerance)
+{
+    Report report;
+
+    scale = std::max<uint64_t>(scale, 1);
+
+    {
+        uint64_t count = 1000000 * scale;
+
+        generator::MassBuffer optimized_buffer(1, count);
+        generator::MassBuffer reference_buffer(1, count);
+        std::istream optimized_reader(&optimized_buffer);
+        std::istream reference_reader(&reference_buffer);
+
+        auto optimized = fuel::stream_requirement(optimized_reader);
+        auto expected = reference::fuel_requirement(reference_reader);
+
+        report.check("fuel::stream_requirement", optimized.x == expected.x && optimized.y == expected.y, std::to_string(count) + " masses");
+    }
+
+    {
+        std::stringstream optimized_reader("100\n200\nabc\n300\n");
+        std::stringstream reference_reader("100\n200\n300\n");
+
+        auto optimized = fuel::stream_requirement(optimized_reader);
+        auto expected = reference::fuel_requirement(reference_reader);
+
+        report.check("fuel::stream_requirement/malformed", optimized.x == expected.x && optimized.y == expected.y, std::to_string(optimized.x) + " expected " + std::to_string(expected.x));
+    }
+
+    for(uint64_t seed = 0; seed < 8; ++seed)
+    {
+        auto masses = generator::masses(seed, 1 + seed * 12345 * scale);
+
+        std::stringstream text;
+        for(auto mass: masses)
+        {
+            text << mass << (seed % 2 ? ',' : '\n');
+        }
+
+        std::vector<int64_t> parsed;
+        parse_integers(text.str(), parsed);
+
+        auto separated_text = text.str();
+        std::replace(separated_text.begin(), separated_text.end(), ',', '\n');
+
+        std::stringstream reader(separated_text);
+        auto expected = reference::fuel_requirement(reader);
+
+        report.check("parse_integers/seed " + std::to_string(seed), parsed == masses);
+        report.check("fuel::requirement/seed " + std::to_string(seed), fuel::requirement(masses) == expected.x && fuel::total_requirement(masses) == expected.y);
+    }
+
+    {
+        std::vector<int64_t> parsed;
+        size_t skipped_count = parse_integers(std::string_view("1,99999999999999999999,abc12,-5 12abc\n-9223372036854775808 - 7,"), parsed);
+
+        report.check("parse_integers/malformed", skipped_count == 4 && parsed == std::vector<int64_t>{1, -5, std::numeric_limits<int64_t>::min(), 7}, std::to_string(skipped_count) + " token(s) skipped");
+
+        std::vector<int16_t> narrow;
+        skipped_count = parse_integers(std::string_view("32767 32768 -32769"), narrow);
+
+        report.check("parse_integers/out of range", skipped_count == 2 && narrow == std::vector<int16_t>{32767}, std::to_string(skipped_count) + " token(s) skipped");
+    }
+
+    for(uint64_t seed = 0; seed < 8; ++seed)
+    {
+        auto program = generator::intcode_loop(seed, 1 + seed * 8, 1 + seed * 100 * scale);
+        auto optimized = intcode::program_caller(program.integers, {program.loop_count, 0});
+        auto expected = reference::intcode_program(program.integers, {program.loop_count, 0});
+
+        report.check("intcode::program_caller/seed " + std::to_string(seed), optimized.x == expected.x && optimized.y == expected.y && optimized.y == program.diagnostic_code, std::to_string(optimized.y) + " expected " + std::to_string(program.diagnostic_code));
+    }
+
+    {
+        std::vector<int64_t> program = {1, 9, 10, 3, 2, 3, 11, 0, 99, 30, 40, 50};
+        auto optimized = intcode::program_caller(program, {9, 10});
+        auto expected = reference::intcode_program(program, {9, 10});
+
+        report.check("intcode::program_caller/noun and verb", optimized.x == expected.x && optimized.x == 3500, std::to_string(optimized.x) + " expected " + std::to_string(expected.x));
+    }
+
+    for(uint64_t seed = 0; seed < 16; ++seed)
+    {
+        auto range = generator::password_range(seed);
+
+        Vector2<int64_t> expected = {0, 0};
+        for(auto number = range.x; number <= range.y; ++number)
+        {
+            expected.x += reference::password_criteria(number, false);
+            expected.y += reference::password_criteria(number, true);
+        }
+
+        std::string name = std::to_string(range.x) + '-' + std::to_string(range.y);
+        report.check("password::criteria_count/" + name, password::criteria_count(range) == expected.x);
+        report.check("password::group_criteria_count/" + name, password::group_criteria_count(range) == expected.y);
+    }
+
+    for(uint64_t seed = 0; seed < 8; ++seed)
+    {
+        size_t width = seed % 2 ? 1 + seed : 1000;
+        auto orbits = generator::orbits(seed, 500 * (1 + seed) * scale, width);
+        auto expected = reference::orbit_counts(orbits);
+
+        std::string name = "seed " + std::to_string(seed) + ", width " + std::to_string(width);
+        report.check("orbit::total_count/" + name, orbit::total_count(orbits) == expected.x);
+        report.check("orbit::transfer_count/" + name, orbit::transfer_count(orbits) == expected.y);
+        report.check("orbit::transfer_count/parents/" + name, orbit::transfer_count(orbit::parents(orbits), "YOU", "SAN") == expected.y);
+    }
+
+    {
+        auto orbits = generator::orbits(8, 50000 * scale, 1000);
+        auto expected = reference::orbit_counts(orbits);
+
+        report.check("orbit::total_count/long names", orbit::total_count(orbits) == expected.x, orbits.front());
+        report.check("orbit::transfer_count/long names", orbit::transfer_count(orbits) == expected.y);
+    }
+
+    for(uint64_t seed = 0; seed < 8; ++seed)
+    {
+        std::array<std::vector<std::string>, 2> wires = {generator::wire(2 * seed, (40 << seed) * scale, 20), generator::wire(2 * seed + 1, (40 << seed) * scale, 20)};
+        auto expected = reference::wire_distances(wires);
+
+        report.check("wire_line::closest_intersection/seed " + std::to_string(seed), wire_line::closest_intersection(wires).standard() == expected.x);
+        report.check("wire_line::fewest_combined_steps/seed " + std::to_string(seed), wire_line::fewest_combined_steps(wires).standard() == expected.y);
+    }
+
+    {
+        auto program = generator::intcode_loop(1, 16, 10);
+        auto orbits = generator::orbits(1, 1000, 100);
+        std::array<std::vector<std::string>, 2> wires = {generator::wire(1, 40, 20), generator::wire(2, 40, 20)};
+        auto masses = generator::masses(1, 1000);
+
+        std::vector<std::byte> buffer(size_t(1) << 26);
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        TrackingResource tracking(&arena);
+
+        bool passed = allocates_from_given_resource([&program, &tracking]()
+        {
+            std::pmr::vector<int64_t> memory(&tracking);
+
+            for(int run = 0; run < 100; ++run)
+            {
+                intcode::program_caller(program.integers, {program.loop_count, 0}, memory);
+            }
+        });
+
+        report.check("memory/intcode::program_caller", passed && tracking.allocation_count() == 1, std::to_string(tracking.allocation_count()) + " allocation(s) for 100 runs");
+
+        report.check("memory/orbit", allocates_from_given_resource([&orbits, &tracking]()
+        {
+            orbit::total_count(orbits, &tracking);
+            orbit::transfer_count(orbits, &tracking);
+        }));
+
+        report.check("memory/wire_line", allocates_from_given_resource([&wires, &tracking]()
+        {
+            wire_line::closest_intersection(wires, &tracking);
+            wire_line::fewest_combined_steps(wires, &tracking);
+        }));
+
+        report.check("memory/fuel", allocates_from_given_resource([&masses, &tracking]()
+        {
+            fuel::requirement(masses, &tracking);
+            fuel::total_requirement(masses, &tracking);
+        }));
+
+        // Above one block per thread and 1 << 16 points, so that the threaded paths run
+        auto threaded_masses = generator::masses(2, 4 * fuel::block_size);
+
+        report.check("memory/fuel::parallel_requirement (4 threads)", allocates_from_given_resource([&threaded_masses, &tracking]()
+        {
+            fuel::parallel_requirement(threaded_masses.data(), threaded_masses.size(), 4, &tracking);
+        }, 4));
+
+        std::mt19937_64 random(0);
+        std::uniform_int_distribution<int64_t> coordinate(-1000, 1000);
+        std::vector<Vector2<int64_t>> points(size_t(1) << 17);
+
+        for(auto& point: points)
+        {
+            point = {coordinate(random), coordinate(random)};
+        }
+
+        report.check("memory/Vector2Map::insert_steps (4 threads)", allocates_from_given_resource([&points, &tracking]()
+        {
+            Vector2Map<int64_t> steps(1, 8, &tracking);
+            steps.insert_steps(points.data(), points.size(), 4);
+        }, 4));
+    }
+
+    for(uint64_t seed = 0; seed < 4; ++seed)
+    {
+        std::mt19937_64 random(seed);
+        std::uniform_int_distribution<int64_t> coordinate(-1000, 1000);
+
+        size_t count = 100000 * scale;
+
+        std::vector<Vector2<int64_t>> points(count);
+        std::map<std::pair<int64_t, int64_t>, int64_t> expected;
+
+        for(size_t step = 0; step < count; ++step)
+        {
+            points[step] = {coordinate(random), coordinate(random)};
+            expected.insert({{points[step].x, points[step].y}, int64_t(step + 1)});
+        }
+
+        Vector2Map<int64_t> steps(seed % 2 ? count : 1, size_t(1) << seed);
+        steps.insert_steps(points.data(), points.size(), 1 + seed);
+
+        bool passed = steps.size() == expected.size();
+
+        for(const auto& [point, step]: expected)
+        {
+            passed = passed && steps.find({point.first, point.second}) == step;
+        }
+
+        passed = passed && !steps.find({5000, -5000});
+
+        report.check("Vector2Map/seed " + std::to_string(seed), passed, std::to_string(steps.size()) + " points");
+    }
+
+    {
+        Vector2Map<int64_t> steps(16);
+
+        bool passed = !steps.find({int64_t(1) << 32, 0}) && !steps.find({std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min()});
+
+        for(Vector2<int64_t> point: {Vector2<int64_t>{int64_t(1) << 32, 0}, Vector2<int64_t>{0, -(int64_t(1) << 31) - 1}, Vector2<int64_t>{std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min()}})
+        {
+            try
+            {
+                steps.insert(point, 1);
+                passed = false;
+            }
+            catch(const std::out_of_range&)
+            {
+            }
+        }
+
+        report.check("Vector2Map/out of range", passed && steps.size() == 0);
+    }
+
+    auto check_exponent = [&report, tolerance](const std::string& name, double expected, const std::vector<size_t>& sizes, auto prepare, auto function)
+    {
+        double exponent = fit_exponent(sizes, prepare, function);
+
+        std::stringstream detail;
+        detail << "n^" << std::fixed << std::setprecision(2) << exponent << ", expected n^" << expected;
+
+        report.check("complexity/" + name, exponent <= expected + tolerance, detail.str());
+    };
+
+    auto masses = [](size_t size)
+    {
+        return generator::masses(size, size);
+    };
+
+    auto mass_text = [](size_t size)
+    {
+        std::string text;
+        for(auto mass: generator::masses(size, size))
+        {
+            text += std::to_string(mass) + ',';
+        }
+
+        return text;
+    };
+
+    check_exponent("fuel::requirement", 1, doubling_sizes((1 << 16) * scale, 5), masses, [](const std::vector<int64_t>& masses)
+    {
+        fuel::requirement(masses);
+    });
+
+    check_exponent("fuel::stream_requirement", 1, doubling_sizes((1 << 16) * scale, 5), mass_text, [](const std::string& text)
+    {
+        std::istringstream reader(text);
+        fuel::stream_requirement(reader);
+    });
+
+    check_exponent("parse_integers", 1, doubling_sizes((1 << 16) * scale, 5), mass_text, [](const std::string& text)
+    {
+        std::vector<int64_t> parsed;
+        parse_integers(text, parsed);
+    });
+
+    check_exponent("intcode::program_caller", 1, doubling_sizes((1 << 12) * scale, 5), [](size_t size)
+    {
+        return generator::intcode_loop(size, 16, size);
+    },
+    [](const generator::Program& program)
+    {
+        intcode::program_caller(program.integers, {program.loop_count, 0});
+    });
+
+    for(size_t width: {size_t(0), size_t(1)})
+    {
+        std::string shape = width ? "/deep" : "/wide";
+
+        auto orbits = [width](size_t size)
+        {
+            return generator::orbits(size, size, width ? width : size);
+        };
+
+        check_exponent("orbit::total_count" + shape, 1.2, doubling_sizes((1 << 12) * scale, 5), orbits, [](const std::vector<std::string>& orbits)
+        {
+            orbit::total_count(orbits);
+        });
+
+        check_exponent("orbit::transfer_count" + shape, 1.2, doubling_sizes((1 << 12) * scale, 5), orbits, [](const std::vector<std::string>& orbits)
+        {
+            orbit::transfer_count(orbits);
+        });
+    }
+
+    // Sizes stay small enough at scale 1 for the map to fit in cache, whose misses would otherwise read as a higher exponent
+    check_exponent("wire_line::closest_intersection", 1, doubling_sizes((1 << 10) * scale, 5), [](size_t size)
+    {
+        return std::array<std::vector<std::string>, 2>{generator::wire(size, size, 20), generator::wire(size + 1, size, 20)};
+    },
+    [](const std::array<std::vector<std::string>, 2>& wires)
+    {
+        wire_line::closest_intersection(wires);
+    });
+
+    std::cout << report.failures << " failed check(s)" << std::endl;
+
+    return report.failures;
+}
+
+} // namespace verification
@@ -0,0 +1,27 @@
+#ifndef ADVENT_OF_CODE_VERIFICATION_HPP
+#define ADVENT_OF_CODE_VERIFICATION_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include <cstdint>
+
+/////////////////////////////////////////////////
+namespace verification
+{
+/////////////////////////////////////////////////
+/// \brief Compares the optimized code paths with
+/// their references on seeded inputs, then checks
+/// that no path scales worse than expected
+///
+/// \param scale Multiplier of the generated input
+/// sizes, 1000 streams billions of masses
+///
+/// \return Number of failed checks
+///
+/////////////////////////////////////////////////
+int run(uint64_t scale, double tolerance = 0.3);
+
+} // namespace verification
+
+#endif // ADVENT_OF_CODE_VERIFICATION_HPP
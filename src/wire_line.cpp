@@ -0,0 +1,163 @@
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "wire_line.hpp"
+
+/////////////////////////////////////////////////
+namespace wire_line
+{
+/////////////////////////////////////////////////
+std::pmr::vector<Vector2<int64_t>> definer(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<Vector2<int64_t>> points(resource);
+
+    auto step_count = [](const std::string& next)
+    {
+        int64_t max_step = 0;
+        std::from_chars(next.data() + std::min<size_t>(next.size(), 1), next.data() + next.size(), max_step);
+        return max_step;
+    };
+
+    size_t point_count = 0;
+    for(const auto& next: inputs)
+    {
+        point_count += std::max<int64_t>(step_count(next), 0);
+    }
+
+    points.reserve(point_count);
+
+    Vector2<int64_t> reading_position = {0, 0};
+
+    for(const auto& next: inputs)
+    {
+        char direction = next.empty() ? '\0' : next[0];
+        int64_t max_step = step_count(next);
+
+        for(int64_t step = 0; step < max_step; ++step)
+        {
+            switch(direction)
+            {
+            case 'L':
+                reading_position.x -= 1;
+                break;
+            case 'U':
+                reading_position.y -= 1;
+                break;
+            case 'R':
+                reading_position.x += 1;
+                break;
+            case 'D':
+                reading_position.y += 1;
+                break;
+            default:
+                break;
+            }
+
+            points.push_back(reading_position);
+        }
+    }
+
+    return points;
+}
+
+/////////////////////////////////////////////////
+Vector2Map<int64_t> first_steps(const std::pmr::vector<Vector2<int64_t>>& wire, std::pmr::memory_resource* resource)
+{
+    Vector2Map<int64_t> steps(wire.size(), hardware_threads(), resource);
+    steps.insert_steps(wire.data(), wire.size());
+
+    return steps;
+}
+
+/////////////////////////////////////////////////
+std::pmr::vector<Vector2<int64_t>> intersections(std::pmr::vector<Vector2<int64_t>>& first_wire, std::pmr::vector<Vector2<int64_t>>& second_wire, std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<Vector2<int64_t>> intersection_points(resource);
+
+    auto first_wire_steps = first_steps(first_wire, resource);
+
+    for(auto second_wire_point: second_wire)
+    {
+        if(first_wire_steps.find(second_wire_point))
+        {
+            intersection_points.push_back(second_wire_point);
+        }
+    }
+
+    return intersection_points;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> closest_intersection(const std::array<std::vector<std::string>, 2>& wires, std::pmr::memory_resource* resource)
+{
+    Vector2<int64_t> closest_wire = {0, 0};
+
+    auto&& first_wire = definer(wires[0], resource);
+    auto&& second_wire = definer(wires[1], resource);
+
+    auto&& intersection_points = intersections(first_wire, second_wire, resource);
+
+    for(auto intersection: intersection_points)
+    {
+        if((closest_wire.x == 0 && closest_wire.y == 0) || (std::abs(intersection.x) + std::abs(intersection.y) < closest_wire.standard()))
+        {
+            closest_wire = {std::abs(intersection.x), std::abs(intersection.y)};
+        }
+    }
+
+    return closest_wire;
+}
+
+/////////////////////////////////////////////////
+Vector2<int64_t> fewest_combined_steps(const std::array<std::vector<std::string>, 2>& wires, std::pmr::memory_resource* resource)
+{
+    auto&& first_wire = definer(wires[0], resource);
+    auto&& second_wire = definer(wires[1], resource);
+
+    auto first_wire_steps = first_steps(first_wire, resource);
+
+    Vector2<int64_t> fewest = {int64_t(first_wire.size()), int64_t(second_wire.size())};
+
+    for(size_t second_wire_step = 0; second_wire_step < second_wire.size(); ++second_wire_step)
+    {
+        auto first_wire_step = first_wire_steps.find(second_wire[second_wire_step]);
+
+        if(first_wire_step)
+        {
+            Vector2<int64_t> step = {*first_wire_step, int64_t(second_wire_step + 1)};
+
+            if(step.standard() < fewest.standard())
+            {
+                fewest = step;
+            }
+        }
+    }
+
+    return fewest;
+}
+
+/////////////////////////////////////////////////
+std::array<std::vector<std::string>, 2> input_list(const MappedFile& file)
+{
+    std::vector<std::string> wires = get_input_list<std::string>(file);
+
+    std::array<std::vector<std::string>, 2> wire_points;
+
+    for(size_t wire = 0; wire < wires.size() && wire < wire_points.size(); wire++)
+    {
+        for(auto token: Tokens(wires[wire], ","))
+        {
+            wire_points[wire].emplace_back(token);
+        }
+    }
+
+    return wire_points;
+}
+
+/////////////////////////////////////////////////
+std::array<std::vector<std::string>, 2> input_list(const std::filesystem::path& path)
+{
+    return input_list(MappedFile(path));
+}
+
+} // namespace wire_line
@@ -0,0 +1,42 @@
+#ifndef ADVENT_OF_CODE_WIRE_LINE_HPP
+#define ADVENT_OF_CODE_WIRE_LINE_HPP
+
+/////////////////////////////////////////////////
+// Headers
+/////////////////////////////////////////////////
+#include "common.hpp"
+
+/////////////////////////////////////////////////
+/// \brief Crossings of two wires on a grid (day 3)
+///
+/////////////////////////////////////////////////
+namespace wire_line
+{
+/////////////////////////////////////////////////
+std::pmr::vector<Vector2<int64_t>> definer(const std::vector<std::string>& inputs, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+/// \brief Maps every point of a wire to the step
+/// it is first reached at
+///
+/////////////////////////////////////////////////
+Vector2Map<int64_t> first_steps(const std::pmr::vector<Vector2<int64_t>>& wire, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+std::pmr::vector<Vector2<int64_t>> intersections(std::pmr::vector<Vector2<int64_t>>& first_wire, std::pmr::vector<Vector2<int64_t>>& second_wire, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+Vector2<int64_t> closest_intersection(const std::array<std::vector<std::string>, 2>& wires, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+Vector2<int64_t> fewest_combined_steps(const std::array<std::vector<std::string>, 2>& wires, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+/////////////////////////////////////////////////
+std::array<std::vector<std::string>, 2> input_list(const MappedFile& file);
+
+/////////////////////////////////////////////////
+std::array<std::vector<std::string>, 2> input_list(const std::filesystem::path& path);
+
+} // namespace wire_line
+
+#endif // ADVENT_OF_CODE_WIRE_LINE_HPP